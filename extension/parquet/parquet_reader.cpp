@@ -26,8 +26,10 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -940,6 +942,40 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterBloom(Vector &v, const BloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(v, hashes, count);
+	hashes.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			auto is_valid = vdata.validity.RowIsValid(vdata.sel->get_index(i));
+			filter_mask.set(i, is_valid && bloom_filter.Lookup(hash_data[i]));
+		}
+	}
+}
+
+static void FilterIn(Vector &v, const InFilter &in_filter, parquet_filter_t &filter_mask, idx_t count) {
+	SelectionVector sel(count);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_tuple_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	in_filter.Filter(v, vdata, sel, count, approved_tuple_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -994,6 +1030,12 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER:
+		FilterIn(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
 	default:
 		D_ASSERT(0);
 		break;
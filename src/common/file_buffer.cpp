@@ -5,6 +5,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/storage/storage_info.hpp"
 #include <cstring>
 
@@ -23,6 +24,8 @@ void FileBuffer::Init() {
 	size = 0;
 	internal_buffer = nullptr;
 	internal_size = 0;
+	malloced_buffer = nullptr;
+	malloced_size = 0;
 }
 
 FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(source.allocator), type(type_p) {
@@ -31,28 +34,62 @@ FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p) : allocator(so
 	size = source.size;
 	internal_buffer = source.internal_buffer;
 	internal_size = source.internal_size;
+	malloced_buffer = source.malloced_buffer;
+	malloced_size = source.malloced_size;
 
 	source.Init();
 }
 
 FileBuffer::~FileBuffer() {
-	if (!internal_buffer) {
+	if (!malloced_buffer) {
 		return;
 	}
-	allocator.FreeData(internal_buffer, internal_size);
+	allocator.FreeData(malloced_buffer, malloced_size);
+}
+
+static bool IsSectorAligned(data_ptr_t buffer) {
+	return cast_pointer_to_uint64(buffer) % Storage::SECTOR_SIZE == 0;
 }
 
 void FileBuffer::ReallocBuffer(size_t new_size) {
-	data_ptr_t new_buffer;
-	if (internal_buffer) {
-		new_buffer = allocator.ReallocateData(internal_buffer, internal_size, new_size);
+	// the allocator typically returns memory that is aligned to the sector size for allocations of this size
+	// if it does not, we allocate (SECTOR_SIZE - 1) additional bytes so that we can align the internal buffer
+	static constexpr idx_t ALIGNMENT_PADDING = Storage::SECTOR_SIZE - 1;
+	const bool padded = malloced_size != internal_size;
+	// realloc retains the contents at the same offset from the start of the allocated memory
+	auto contents_offset = NumericCast<idx_t>(internal_buffer - malloced_buffer);
+	auto contents_size = MinValue<idx_t>(internal_size, new_size);
+
+	auto new_malloced_size = padded ? new_size + ALIGNMENT_PADDING : new_size;
+	data_ptr_t new_malloced_buffer;
+	if (malloced_buffer) {
+		new_malloced_buffer = allocator.ReallocateData(malloced_buffer, malloced_size, new_malloced_size);
 	} else {
-		new_buffer = allocator.AllocateData(new_size);
+		new_malloced_buffer = allocator.AllocateData(new_malloced_size);
 	}
-	if (!new_buffer) {
+	if (!new_malloced_buffer) {
 		throw std::bad_alloc();
 	}
-	internal_buffer = new_buffer;
+	if (!padded && type != FileBufferType::TINY_BUFFER && !IsSectorAligned(new_malloced_buffer)) {
+		// we never do IO on tiny buffers, so only the other buffers have to be aligned
+		new_malloced_size = new_size + ALIGNMENT_PADDING;
+		new_malloced_buffer = allocator.ReallocateData(new_malloced_buffer, new_size, new_malloced_size);
+		if (!new_malloced_buffer) {
+			throw std::bad_alloc();
+		}
+	}
+	malloced_buffer = new_malloced_buffer;
+	malloced_size = new_malloced_size;
+
+	internal_buffer = malloced_buffer;
+	if (malloced_size != new_size) {
+		internal_buffer =
+		    cast_uint64_to_pointer(AlignValue<uint64_t, Storage::SECTOR_SIZE>(cast_pointer_to_uint64(malloced_buffer)));
+	}
+	if (contents_size > 0 && internal_buffer != malloced_buffer + contents_offset) {
+		// the alignment changed, move the contents to the new internal buffer
+		memmove(internal_buffer, malloced_buffer + contents_offset, contents_size);
+	}
 	internal_size = new_size;
 	// Caller must update these.
 	buffer = nullptr;
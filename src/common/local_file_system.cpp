@@ -5,10 +5,12 @@
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 #include <cstdint>
 #include <cstdio>
@@ -58,6 +60,19 @@ extern "C" WINBASEAPI BOOL QueryFullProcessImageNameW(HANDLE, DWORD, LPWSTR, PDW
 #include <restartmanager.h>
 #endif
 
+// io_uring is used for batched reads if the kernel headers support it, we fall back to pread if it is not available
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define DUCKDB_IO_URING_AVAILABLE
+#endif
+#endif
+#endif
+
 namespace duckdb {
 
 #ifndef _WIN32
@@ -129,13 +144,16 @@ bool LocalFileSystem::IsPipe(const string &filename, optional_ptr<FileOpener> op
 
 struct UnixFileHandle : public FileHandle {
 public:
-	UnixFileHandle(FileSystem &file_system, string path, int fd) : FileHandle(file_system, std::move(path)), fd(fd) {
+	UnixFileHandle(FileSystem &file_system, string path, int fd, bool direct_io)
+	    : FileHandle(file_system, std::move(path)), fd(fd), direct_io(direct_io) {
 	}
 	~UnixFileHandle() override {
 		UnixFileHandle::Close();
 	}
 
 	int fd;
+	//! Whether the file was opened for direct IO, in which case memory buffers must be aligned to the sector size
+	bool direct_io;
 
 public:
 	void Close() override {
@@ -417,7 +435,7 @@ unique_ptr<FileHandle> LocalFileSystem::OpenFile(const string &path_p, FileOpenF
 			}
 		}
 	}
-	return make_uniq<UnixFileHandle>(*this, path, fd);
+	return make_uniq<UnixFileHandle>(*this, path, fd, flags.DirectIO());
 }
 
 void LocalFileSystem::SetFilePointer(FileHandle &handle, idx_t location) {
@@ -439,7 +457,41 @@ idx_t LocalFileSystem::GetFilePointer(FileHandle &handle) {
 	return UnsafeNumericCast<idx_t>(position);
 }
 
+//! Direct IO requires the memory buffer, location and size to be aligned to the sector size. FileBuffers are always
+//! aligned. Small reads that are not aligned, such as reading the magic bytes of a database file, read the
+//! surrounding sectors into an aligned intermediate buffer instead.
+class DirectIOBuffer {
+public:
+	explicit DirectIOBuffer(int64_t nr_bytes)
+	    : allocation(make_unsafe_uniq_array<data_t>(UnsafeNumericCast<idx_t>(nr_bytes) + Storage::SECTOR_SIZE)) {
+		auto address = cast_pointer_to_uint64(allocation.get());
+		buffer = cast_uint64_to_pointer(AlignValue<uint64_t, Storage::SECTOR_SIZE>(address));
+	}
+
+	static bool RequiresAlignment(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+		if (!handle.Cast<UnixFileHandle>().direct_io) {
+			return false;
+		}
+		return cast_pointer_to_uint64(buffer) % Storage::SECTOR_SIZE != 0 ||
+		       UnsafeNumericCast<idx_t>(nr_bytes) % Storage::SECTOR_SIZE != 0 || location % Storage::SECTOR_SIZE != 0;
+	}
+
+	data_ptr_t buffer;
+
+private:
+	unsafe_unique_array<data_t> allocation;
+};
+
 void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (DirectIOBuffer::RequiresAlignment(handle, buffer, nr_bytes, location)) {
+		auto aligned_start = AlignValueFloor<idx_t, Storage::SECTOR_SIZE>(location);
+		auto aligned_end = AlignValue<idx_t, Storage::SECTOR_SIZE>(location + UnsafeNumericCast<idx_t>(nr_bytes));
+		auto aligned_bytes = UnsafeNumericCast<int64_t>(aligned_end - aligned_start);
+		DirectIOBuffer aligned_buffer(aligned_bytes);
+		Read(handle, aligned_buffer.buffer, aligned_bytes, aligned_start);
+		memcpy(buffer, aligned_buffer.buffer + (location - aligned_start), UnsafeNumericCast<size_t>(nr_bytes));
+		return;
+	}
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	auto read_buffer = char_ptr_cast(buffer);
 	while (nr_bytes > 0) {
@@ -471,6 +523,11 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 }
 
 void LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (DirectIOBuffer::RequiresAlignment(handle, buffer, nr_bytes, location)) {
+		// we would have to read-modify-write the surrounding sectors, all writers should write aligned FileBuffers
+		throw InternalException("Direct IO write to file \"%s\" is not aligned to the sector size (%lld bytes at %llu)",
+		                        handle.path, nr_bytes, location);
+	}
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	auto write_buffer = char_ptr_cast(buffer);
 	while (nr_bytes > 0) {
@@ -507,6 +564,227 @@ int64_t LocalFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_byte
 	return bytes_written;
 }
 
+#ifdef DUCKDB_IO_URING_AVAILABLE
+//! A minimal io_uring instance, used to submit a batch of positional reads with a single system call
+class IOUring {
+public:
+	//! The maximum amount of reads that are submitted at once
+	static constexpr const idx_t QUEUE_DEPTH = 64;
+
+public:
+	IOUring() {
+	}
+	~IOUring() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ptr && cq_ptr != sq_ptr) {
+			munmap(cq_ptr, cq_size);
+		}
+		if (sq_ptr) {
+			munmap(sq_ptr, sq_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+	}
+
+	//! Sets up an io_uring instance, returns nullptr if that is not possible (e.g., the kernel does not support it)
+	static unique_ptr<IOUring> TryCreate() {
+		auto ring = make_uniq<IOUring>();
+		if (!ring->Initialize()) {
+			return nullptr;
+		}
+		return ring;
+	}
+
+	//! Performs up to QUEUE_DEPTH reads, and stores the result (bytes read, or -errno) of each of them in "results".
+	//! Returns false if the reads could not be submitted, in which case the ring should no longer be used.
+	bool Read(int fd, const FileReadRequest *requests, idx_t count, int64_t *results) {
+		D_ASSERT(count <= QUEUE_DEPTH);
+		iovec iovecs[QUEUE_DEPTH];
+		auto tail = *sq_tail;
+		for (idx_t i = 0; i < count; i++) {
+			auto index = tail & *sq_mask;
+			auto &sqe = sqes[index];
+			memset(&sqe, 0, sizeof(io_uring_sqe));
+			iovecs[i].iov_base = requests[i].buffer;
+			iovecs[i].iov_len = requests[i].nr_bytes;
+			sqe.opcode = IORING_OP_READV;
+			sqe.fd = fd;
+			sqe.addr = cast_pointer_to_uint64(&iovecs[i]);
+			sqe.len = 1;
+			sqe.off = requests[i].location;
+			sqe.user_data = i;
+			sq_array[index] = index;
+			tail++;
+		}
+		__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+		idx_t submitted = 0;
+		string error;
+		while (submitted < count) {
+			auto res = syscall(__NR_io_uring_enter, ring_fd, count - submitted, 0, 0, nullptr, 0);
+			if (res < 0) {
+				if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+					continue;
+				}
+				if (submitted == 0) {
+					// nothing is in flight, the caller discards the ring (and the reads that are left in it)
+					return false;
+				}
+				// reads are in flight that write into the buffers, we have to wait for them before we throw
+				error = StringUtil::Format("Could not submit batched reads: %s", strerror(errno));
+				break;
+			}
+			submitted += UnsafeNumericCast<idx_t>(res);
+		}
+
+		idx_t completed = 0;
+		while (completed < submitted) {
+			auto head = *cq_head;
+			auto cq_tail_value = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+			if (head == cq_tail_value) {
+				// wait for the remaining reads to complete
+				if (!error.empty()) {
+					// io_uring_enter failed before, the kernel still posts the completions, so we poll for them
+					std::this_thread::yield();
+					continue;
+				}
+				auto res = syscall(__NR_io_uring_enter, ring_fd, 0, submitted - completed, IORING_ENTER_GETEVENTS,
+				                   nullptr, 0);
+				if (res < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+					error = StringUtil::Format("Could not wait for batched reads: %s", strerror(errno));
+				}
+				continue;
+			}
+			for (; head != cq_tail_value; head++) {
+				auto &cqe = cqes[head & *cq_mask];
+				results[cqe.user_data] = cqe.res;
+				completed++;
+			}
+			__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+		}
+		if (!error.empty()) {
+			// all reads that were submitted have completed, so it is safe to throw (the caller discards the ring)
+			throw IOException(error);
+		}
+		return true;
+	}
+
+private:
+	bool Initialize() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(io_uring_params));
+		auto fd = syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params);
+		if (fd < 0) {
+			return false;
+		}
+		ring_fd = NumericCast<int>(fd);
+
+		sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (single_mmap) {
+			sq_size = MaxValue(sq_size, cq_size);
+			cq_size = sq_size;
+		}
+		sq_ptr = Map(sq_size, IORING_OFF_SQ_RING);
+		if (!sq_ptr) {
+			return false;
+		}
+		cq_ptr = single_mmap ? sq_ptr : Map(cq_size, IORING_OFF_CQ_RING);
+		if (!cq_ptr) {
+			return false;
+		}
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = reinterpret_cast<io_uring_sqe *>(Map(sqes_size, IORING_OFF_SQES));
+		if (!sqes) {
+			return false;
+		}
+
+		auto sq_base = static_cast<data_ptr_t>(sq_ptr);
+		sq_tail = reinterpret_cast<unsigned *>(sq_base + params.sq_off.tail);
+		sq_mask = reinterpret_cast<unsigned *>(sq_base + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(sq_base + params.sq_off.array);
+		auto cq_base = static_cast<data_ptr_t>(cq_ptr);
+		cq_head = reinterpret_cast<unsigned *>(cq_base + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(cq_base + params.cq_off.tail);
+		cq_mask = reinterpret_cast<unsigned *>(cq_base + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe *>(cq_base + params.cq_off.cqes);
+		return true;
+	}
+
+	void *Map(size_t size, off_t offset) {
+		auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+		return ptr == MAP_FAILED ? nullptr : ptr;
+	}
+
+private:
+	int ring_fd = -1;
+	void *sq_ptr = nullptr;
+	size_t sq_size = 0;
+	void *cq_ptr = nullptr;
+	size_t cq_size = 0;
+	io_uring_sqe *sqes = nullptr;
+	size_t sqes_size = 0;
+
+	unsigned *sq_tail = nullptr;
+	unsigned *sq_mask = nullptr;
+	unsigned *sq_array = nullptr;
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned *cq_mask = nullptr;
+	io_uring_cqe *cqes = nullptr;
+};
+
+//! Caches io_uring instances, so that they can be reused across batches (and threads)
+class IOUringCache {
+public:
+	//! The maximum amount of idle io_uring instances that are kept around
+	static constexpr const idx_t MAX_CACHED_RINGS = 16;
+
+public:
+	static IOUringCache &Get() {
+		static IOUringCache cache;
+		return cache;
+	}
+
+	//! Returns an io_uring instance, or nullptr if io_uring is not supported
+	unique_ptr<IOUring> GetRing() {
+		{
+			lock_guard<mutex> guard(lock);
+			if (!rings.empty()) {
+				auto ring = std::move(rings.back());
+				rings.pop_back();
+				return ring;
+			}
+		}
+		if (!supported) {
+			return nullptr;
+		}
+		auto ring = IOUring::TryCreate();
+		if (!ring) {
+			// don't try again if the kernel does not support io_uring (or it is disabled, e.g., by seccomp)
+			supported = false;
+		}
+		return ring;
+	}
+
+	void ReturnRing(unique_ptr<IOUring> ring) {
+		lock_guard<mutex> guard(lock);
+		if (rings.size() < MAX_CACHED_RINGS) {
+			rings.push_back(std::move(ring));
+		}
+	}
+
+private:
+	mutex lock;
+	vector<unique_ptr<IOUring>> rings;
+	atomic<bool> supported {true};
+};
+#endif
+
 bool LocalFileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 #if defined(__linux__)
 	// FALLOC_FL_PUNCH_HOLE requires glibc 2.18 or up
@@ -1125,6 +1403,43 @@ FileType LocalFileSystem::GetFileType(FileHandle &handle) {
 }
 #endif
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	idx_t request_idx = 0;
+#ifdef DUCKDB_IO_URING_AVAILABLE
+	auto &cache = IOUringCache::Get();
+	auto ring = requests.size() > 1 ? cache.GetRing() : nullptr;
+	if (ring) {
+		int fd = handle.Cast<UnixFileHandle>().fd;
+		int64_t results[IOUring::QUEUE_DEPTH];
+		while (request_idx < requests.size()) {
+			auto count = MinValue<idx_t>(IOUring::QUEUE_DEPTH, requests.size() - request_idx);
+			if (!ring->Read(fd, requests.data() + request_idx, count, results)) {
+				// the reads could not be submitted: perform the remaining reads with pread
+				ring.reset();
+				break;
+			}
+			for (idx_t i = 0; i < count; i++) {
+				// short or failed reads (e.g., misaligned direct IO buffers) are completed (or reported) by Read
+				auto &request = requests[request_idx + i];
+				auto bytes_read = UnsafeNumericCast<idx_t>(MaxValue<int64_t>(results[i], 0));
+				if (bytes_read < request.nr_bytes) {
+					Read(handle, static_cast<data_ptr_t>(request.buffer) + bytes_read,
+					     UnsafeNumericCast<int64_t>(request.nr_bytes - bytes_read), request.location + bytes_read);
+				}
+			}
+			request_idx += count;
+		}
+		if (ring) {
+			cache.ReturnRing(std::move(ring));
+		}
+	}
+#endif
+	for (; request_idx < requests.size(); request_idx++) {
+		auto &request = requests[request_idx];
+		Read(handle, request.buffer, UnsafeNumericCast<int64_t>(request.nr_bytes), request.location);
+	}
+}
+
 bool LocalFileSystem::CanSeek() {
 	return true;
 }
@@ -119,7 +119,7 @@ static unique_ptr<RenderTreeNode> CreateNode(const ProfilingNode &op) {
 	auto &info = op.GetProfilingInfo();
 	InsertionOrderPreservingMap<string> extra_info;
 	if (info.Enabled(MetricsType::EXTRA_INFO)) {
-		extra_info = op.GetProfilingInfo().extra_info;
+		extra_info = info.GetExtraInfo();
 	}
 
 	string node_name = "QUERY";
@@ -217,6 +217,7 @@ void TupleDataAllocator::InitializeChunkState(TupleDataSegment &segment, TupleDa
 	// PinProperties::DESTROY_AFTER_DONE, we might destroy a heap block that is needed by a later chunk, e.g.,
 	// when chunk 0 needs heap block 0, chunk 1 does not need any heap blocks, and chunk 2 needs heap block 0 again
 	ReleaseOrStoreHandles(pin_state, segment, chunk, !chunk.heap_block_ids.empty());
+	PrefetchChunkBlocks(pin_state, chunk);
 
 	unsafe_vector<reference<TupleDataChunkPart>> parts;
 	parts.reserve(chunk.parts.size());
@@ -227,6 +228,30 @@ void TupleDataAllocator::InitializeChunkState(TupleDataSegment &segment, TupleDa
 	InitializeChunkStateInternal(pin_state, chunk_state, 0, true, init_heap, init_heap, parts);
 }
 
+void TupleDataAllocator::PrefetchChunkBlocks(TupleDataPinState &pin_state, const TupleDataChunk &chunk) {
+	if (pin_state.properties == TupleDataPinProperties::ALREADY_PINNED) {
+		return;
+	}
+	// only the blocks that were evicted (i.e., unloaded) have to be read
+	vector<shared_ptr<BlockHandle>> handles;
+	for (auto &row_block_id : chunk.row_block_ids) {
+		auto &handle = row_blocks[row_block_id].handle;
+		if (pin_state.row_handles.find(row_block_id) == pin_state.row_handles.end() && handle->IsUnloaded()) {
+			handles.push_back(handle);
+		}
+	}
+	for (auto &heap_block_id : chunk.heap_block_ids) {
+		auto &handle = heap_blocks[heap_block_id].handle;
+		if (pin_state.heap_handles.find(heap_block_id) == pin_state.heap_handles.end() && handle->IsUnloaded()) {
+			handles.push_back(handle);
+		}
+	}
+	if (handles.size() > 1) {
+		// only worth it if there are multiple blocks, a single block is read when it is pinned
+		buffer_manager.Prefetch(handles);
+	}
+}
+
 static inline void InitializeHeapSizes(const data_ptr_t row_locations[], idx_t heap_sizes[], const idx_t offset,
                                        const idx_t next, const TupleDataChunkPart &part, const idx_t heap_size_offset) {
 	// Read the heap sizes from the rows
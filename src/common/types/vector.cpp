@@ -2,6 +2,7 @@
 
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/fsst.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
@@ -230,9 +231,17 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	}
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		// already a dictionary, slice the current dictionary
-		auto &current_sel = DictionaryVector::SelVector(*this);
-		auto sliced_dictionary = current_sel.Slice(sel, count);
-		buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		auto &current_buffer = buffer->Cast<DictionaryBuffer>();
+		auto sliced_dictionary = current_buffer.GetSelVector().Slice(sel, count);
+		auto new_buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		if (GetType().InternalType() != PhysicalType::STRUCT) {
+			// the slice still references the same dictionary
+			if (current_buffer.GetDictionarySize().IsValid()) {
+				new_buffer->SetDictionarySize(current_buffer.GetDictionarySize().GetIndex());
+			}
+			new_buffer->SetDictionaryId(current_buffer.GetDictionaryId());
+		}
+		buffer = std::move(new_buffer);
 		if (GetType().InternalType() == PhysicalType::STRUCT) {
 			auto &child_vector = DictionaryVector::Child(*this);
 
@@ -269,7 +278,13 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 		auto entry = cache.cache.find(target_data);
 		if (entry != cache.cache.end()) {
 			// cached entry exists: use that
-			this->buffer = make_buffer<DictionaryBuffer>(entry->second->Cast<DictionaryBuffer>().GetSelVector());
+			auto &cached_buffer = entry->second->Cast<DictionaryBuffer>();
+			auto new_buffer = make_buffer<DictionaryBuffer>(cached_buffer.GetSelVector());
+			if (cached_buffer.GetDictionarySize().IsValid()) {
+				new_buffer->SetDictionarySize(cached_buffer.GetDictionarySize().GetIndex());
+			}
+			new_buffer->SetDictionaryId(cached_buffer.GetDictionaryId());
+			this->buffer = std::move(new_buffer);
 			vector_type = VectorType::DICTIONARY_VECTOR;
 		} else {
 			Slice(sel, count);
@@ -280,6 +295,16 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 	}
 }
 
+void Vector::Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count) {
+	Reference(dict);
+	bool flat_dictionary = GetVectorType() == VectorType::FLAT_VECTOR;
+	Slice(sel, count);
+	if (flat_dictionary && GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		// only dictionaries over flat vectors have a known size
+		buffer->Cast<DictionaryBuffer>().SetDictionarySize(dictionary_size);
+	}
+}
+
 void Vector::Initialize(bool zero_data, idx_t capacity) {
 	auxiliary.reset();
 	validity.Reset();
@@ -1906,6 +1931,14 @@ void ConstantVector::Reference(Vector &vector, Vector &source, idx_t position, i
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// DictionaryVector
+//===--------------------------------------------------------------------===//
+idx_t DictionaryVector::CreateDictionaryId() {
+	static atomic<idx_t> current_dictionary_id {0};
+	return ++current_dictionary_id;
+}
+
 //===--------------------------------------------------------------------===//
 // StringVector
 //===--------------------------------------------------------------------===//
@@ -313,7 +313,35 @@ static inline void HashTypeSwitch(Vector &input, Vector &result, const Selection
 	}
 }
 
+static bool TryHashDictionary(Vector &input, Vector &result, idx_t count) {
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR ||
+	    input.GetType().InternalType() != PhysicalType::VARCHAR) {
+		return false;
+	}
+	auto &child = DictionaryVector::Child(input);
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= count ||
+	    child.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	// the dictionary is smaller than the vector: hash every dictionary entry once, then look up the hashes
+	Vector dictionary_hashes(LogicalType::HASH, dictionary_size.GetIndex());
+	TemplatedLoopHash<false, string_t>(child, dictionary_hashes, nullptr, dictionary_size.GetIndex());
+	auto dictionary_hash_data = FlatVector::GetData<hash_t>(dictionary_hashes);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<hash_t>(result);
+	auto &sel = DictionaryVector::SelVector(input);
+	for (idx_t i = 0; i < count; i++) {
+		result_data[i] = dictionary_hash_data[sel.get_index(i)];
+	}
+	return true;
+}
+
 void VectorOperations::Hash(Vector &input, Vector &result, idx_t count) {
+	if (TryHashDictionary(input, result, count)) {
+		return;
+	}
 	HashTypeSwitch<false>(input, result, nullptr, count);
 }
 
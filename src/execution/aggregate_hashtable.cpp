@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/null_value.hpp"
@@ -29,6 +30,11 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
     : GroupedAggregateHashTable(context, allocator, std::move(group_types), {}, vector<AggregateObject>()) {
 }
 
+GroupedAggregateHashTable::AggregateDictionaryState::AggregateDictionaryState()
+    : capacity(0), unique_entries(STANDARD_VECTOR_SIZE), hashes(LogicalType::HASH),
+      new_addresses(LogicalType::POINTER) {
+}
+
 GroupedAggregateHashTable::AggregateHTAppendState::AggregateHTAppendState()
     : ht_offsets(LogicalType::UBIGINT), hash_salts(LogicalType::HASH), group_compare_vector(STANDARD_VECTOR_SIZE),
       no_match_vector(STANDARD_VECTOR_SIZE), empty_vector(STANDARD_VECTOR_SIZE), new_groups(STANDARD_VECTOR_SIZE),
@@ -41,7 +47,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), sink_count(0), materialized_count(0), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -59,6 +66,7 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 }
 
 void GroupedAggregateHashTable::InitializePartitionedData() {
+	ResetDictionaryState();
 	if (!partitioned_data || RadixPartitioning::RadixBits(partitioned_data->PartitionCount()) != radix_bits) {
 		D_ASSERT(!partitioned_data || partitioned_data->Count() == 0);
 		partitioned_data =
@@ -140,6 +148,9 @@ idx_t GroupedAggregateHashTable::ApplyBitMask(hash_t hash) const {
 
 void GroupedAggregateHashTable::Verify() {
 #ifdef DEBUG
+	if (skip_lookups) {
+		return; // The pointer table is not used
+	}
 	idx_t total_count = 0;
 	for (idx_t i = 0; i < capacity; i++) {
 		const auto &entry = entries[i];
@@ -155,13 +166,46 @@ void GroupedAggregateHashTable::Verify() {
 }
 
 void GroupedAggregateHashTable::ClearPointerTable() {
-	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
+	if (!skip_lookups) {
+		std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
+	}
+	ResetDictionaryState();
 }
 
 void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::SkipLookups() {
+	D_ASSERT(!skip_lookups);
+	skip_lookups = true;
+	// The pointer table is not used while skipping the lookups, free it
+	hash_map.Reset();
+	entries = nullptr;
+}
+
+void GroupedAggregateHashTable::ResumeLookups() {
+	D_ASSERT(skip_lookups);
+	skip_lookups = false;
+	// Allocate an empty pointer table with the same capacity as before, the groups added so far are not in it
+	hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
+	entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
+	ClearPointerTable();
+	ResetCount();
+}
+
+bool GroupedAggregateHashTable::SkippingLookups() const {
+	return skip_lookups;
+}
+
+idx_t GroupedAggregateHashTable::GetSinkCount() const {
+	return sink_count;
+}
+
+idx_t GroupedAggregateHashTable::GetMaterializedCount() const {
+	return materialized_count;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -227,6 +271,12 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 }
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	auto new_group_count = TryAddDictionaryGroups(groups, payload, filter);
+	if (new_group_count.IsValid()) {
+		sink_count += groups.size();
+		return new_group_count.GetIndex();
+	}
+
 	Vector hashes(LogicalType::HASH);
 	groups.Hash(hashes);
 
@@ -238,6 +288,7 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	if (groups.size() == 0) {
 		return 0;
 	}
+	sink_count += groups.size();
 
 #ifdef DEBUG
 	D_ASSERT(groups.ColumnCount() + 1 == layout.ColumnCount());
@@ -247,6 +298,92 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 #endif
 
 	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+	UpdateAggregates(payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+void GroupedAggregateHashTable::ResetDictionaryState() {
+	state.dict_state.dictionary_id = optional_idx();
+}
+
+optional_idx GroupedAggregateHashTable::TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload,
+                                                               const unsafe_vector<idx_t> &filter) {
+	static constexpr idx_t MAX_DICTIONARY_SIZE = 20000;
+	if (groups.size() == 0 || groups.ColumnCount() != 1) {
+		return optional_idx();
+	}
+	auto &group_vector = groups.data[0];
+	if (group_vector.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return optional_idx();
+	}
+	auto opt_dictionary_size = DictionaryVector::DictionarySize(group_vector);
+	auto &dictionary_id = DictionaryVector::DictionaryId(group_vector);
+	if (!opt_dictionary_size.IsValid() || opt_dictionary_size.GetIndex() > MAX_DICTIONARY_SIZE ||
+	    !dictionary_id.IsValid()) {
+		return optional_idx();
+	}
+	auto dictionary_size = opt_dictionary_size.GetIndex();
+	auto &dictionary_vector = DictionaryVector::Child(group_vector);
+	auto &offsets = DictionaryVector::SelVector(group_vector);
+
+	auto &dict_state = state.dict_state;
+	if (dict_state.dictionary_id != dictionary_id) {
+		// a new dictionary: none of its entries have been looked up yet
+		if (dict_state.capacity < dictionary_size) {
+			dict_state.dictionary_addresses = make_unsafe_uniq_array<data_ptr_t>(dictionary_size);
+			dict_state.found_entry = make_unsafe_uniq_array<bool>(dictionary_size);
+			dict_state.capacity = dictionary_size;
+		}
+		memset(dict_state.found_entry.get(), 0, dictionary_size * sizeof(bool));
+		dict_state.dictionary_id = dictionary_id;
+	}
+
+	// find the dictionary entries that we have not seen before
+	auto &found_entry = dict_state.found_entry;
+	auto &unique_entries = dict_state.unique_entries;
+	idx_t unique_count = 0;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		auto dictionary_idx = offsets.get_index(i);
+		unique_entries.set_index(unique_count, dictionary_idx);
+		unique_count += !found_entry[dictionary_idx];
+		found_entry[dictionary_idx] = true;
+	}
+
+	// look up (or create) the groups of only those entries
+	idx_t new_group_count = 0;
+	auto dictionary_addresses = dict_state.dictionary_addresses.get();
+	if (unique_count > 0) {
+		auto &unique_values = dict_state.unique_values;
+		if (unique_values.ColumnCount() == 0) {
+			unique_values.InitializeEmpty(groups.GetTypes());
+		}
+		unique_values.data[0].Slice(dictionary_vector, unique_entries, unique_count);
+		unique_values.SetCardinality(unique_count);
+		unique_values.Hash(dict_state.hashes);
+
+		new_group_count =
+		    FindOrCreateGroups(unique_values, dict_state.hashes, dict_state.new_addresses, state.new_groups);
+		auto new_addresses = FlatVector::GetData<data_ptr_t>(dict_state.new_addresses);
+		for (idx_t i = 0; i < unique_count; i++) {
+			dictionary_addresses[unique_entries.get_index(i)] = new_addresses[i];
+		}
+	}
+
+	// now fetch the group addresses of every row through the dictionary
+	state.addresses.SetVectorType(VectorType::FLAT_VECTOR);
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		addresses[i] = dictionary_addresses[offsets.get_index(i)];
+	}
+	UpdateAggregates(payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
@@ -276,9 +413,6 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
 		filter_idx++;
 	}
-
-	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -313,12 +447,12 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
-	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	// Need to fit the entire vector, and resize at threshold (unless we do not use the pointer table at all)
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
-	D_ASSERT(capacity - Count() >= groups.size()); // we need to be able to fit at least one vector of data
+	D_ASSERT(skip_lookups || capacity - Count() >= groups.size()); // we need to be able to fit at least one vector
 
 	group_hashes_v.Flatten(groups.size());
 	auto hashes = FlatVector::GetData<hash_t>(group_hashes_v);
@@ -326,20 +460,6 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	addresses_v.Flatten(groups.size());
 	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
 
-	// Compute the entry in the table based on the hash using a modulo,
-	// and precompute the hash salts for faster comparison below
-	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
-	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
-	for (idx_t r = 0; r < groups.size(); r++) {
-		const auto &hash = hashes[r];
-		ht_offsets[r] = ApplyBitMask(hash);
-		D_ASSERT(ht_offsets[r] == hash % capacity);
-		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
-	}
-
-	// we start out with all entries [0, 1, 2, ..., groups.size()]
-	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
-
 	// Make a chunk that references the groups and the hashes and convert to unified format
 	if (state.group_chunk.ColumnCount() == 0) {
 		state.group_chunk.InitializeEmpty(layout.GetTypes());
@@ -359,6 +479,45 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Every row becomes a new group, these are combined with the other groups during the Finalize
+		const auto &append_sel = *FlatVector::IncrementalSelectionVector();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, append_sel, groups.size());
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, append_sel, groups.size());
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		count += groups.size();
+		materialized_count += groups.size();
+		return groups.size();
+	}
+
+	// Compute the entry in the table based on the hash using a modulo,
+	// and precompute the hash salts for faster comparison below
+	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
+	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
+	for (idx_t r = 0; r < groups.size(); r++) {
+		const auto &hash = hashes[r];
+		ht_offsets[r] = ApplyBitMask(hash);
+		D_ASSERT(ht_offsets[r] == hash % capacity);
+		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
+	}
+
+	// For large tables, issue all the (random) loads of the entries first, so the cache misses overlap
+	const bool prefetch = capacity > ht_entry_t::PREFETCH_THRESHOLD;
+	if (prefetch) {
+		for (idx_t r = 0; r < groups.size(); r++) {
+			DUCKDB_PREFETCH(entries + ht_offsets[r]);
+		}
+	}
+
+	// we start out with all entries [0, 1, 2, ..., groups.size()]
+	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -426,6 +585,12 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 				const auto &entry = entries[ht_offsets[index]];
 				addresses[index] = entry.GetPointer();
 			}
+			if (prefetch) {
+				// Likewise, load the rows that we compare the groups with
+				for (idx_t need_compare_idx = 0; need_compare_idx < need_compare_count; need_compare_idx++) {
+					DUCKDB_PREFETCH(addresses[state.group_compare_vector.get_index(need_compare_idx)]);
+				}
+			}
 
 			// Perform group comparisons
 			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
@@ -446,6 +611,7 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 
 	count += new_group_count;
+	materialized_count += new_group_count;
 	return new_group_count;
 }
 
@@ -548,6 +714,7 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 }
 
 void GroupedAggregateHashTable::UnpinData() {
+	ResetDictionaryState();
 	partitioned_data->FlushAppendState(state.append_state);
 	partitioned_data->Unpin();
 }
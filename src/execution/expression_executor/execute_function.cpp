@@ -56,6 +56,69 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 #endif
 }
 
+//! If the only non-constant argument is a dictionary vector, the function is executed once for every distinct
+//! dictionary entry that is referenced, and the result is a dictionary vector over those results
+static bool TryExecuteDictionary(const BoundFunctionExpression &expr, ExpressionState &state, DataChunk &arguments,
+                                 Vector &result) {
+	if (expr.function.stability == FunctionStability::VOLATILE) {
+		return false;
+	}
+	optional_idx dictionary_arg;
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		auto &arg = arguments.data[i];
+		if (arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			continue;
+		}
+		if (arg.GetVectorType() != VectorType::DICTIONARY_VECTOR || dictionary_arg.IsValid()) {
+			return false;
+		}
+		dictionary_arg = i;
+	}
+	if (!dictionary_arg.IsValid()) {
+		return false;
+	}
+	auto &input = arguments.data[dictionary_arg.GetIndex()];
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	auto count = arguments.size();
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= count) {
+		return false;
+	}
+	auto &dictionary = DictionaryVector::Child(input);
+	auto &offsets = DictionaryVector::SelVector(input);
+
+	// find the dictionary entries that are referenced by this chunk
+	static constexpr sel_t INVALID_POSITION = NumericLimits<sel_t>::Maximum();
+	auto positions = make_unsafe_uniq_array<sel_t>(dictionary_size.GetIndex());
+	std::fill_n(positions.get(), dictionary_size.GetIndex(), INVALID_POSITION);
+	SelectionVector unique_entries(count);
+	SelectionVector result_sel(count);
+	idx_t unique_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto entry = offsets.get_index(i);
+		if (positions[entry] == INVALID_POSITION) {
+			positions[entry] = UnsafeNumericCast<sel_t>(unique_count);
+			unique_entries.set_index(unique_count++, entry);
+		}
+		result_sel.set_index(i, positions[entry]);
+	}
+
+	// execute the function on only those entries
+	DataChunk dictionary_arguments;
+	dictionary_arguments.InitializeEmpty(arguments.GetTypes());
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		if (i == dictionary_arg.GetIndex()) {
+			dictionary_arguments.data[i].Slice(dictionary, unique_entries, unique_count);
+		} else {
+			dictionary_arguments.data[i].Reference(arguments.data[i]);
+		}
+	}
+	dictionary_arguments.SetCardinality(unique_count);
+	Vector dictionary_result(result.GetType(), unique_count);
+	expr.function.function(dictionary_arguments, state, dictionary_result);
+	result.Slice(dictionary_result, result_sel, count);
+	return true;
+}
+
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
 	state->intermediate_chunk.Reset();
@@ -75,7 +138,9 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
-	expr.function.function(arguments, *state, result);
+	if (!TryExecuteDictionary(expr, *state, arguments, result)) {
+		expr.function.function(arguments, *state, result);
+	}
 
 	VerifyNullHandling(expr, arguments, result);
 	D_ASSERT(result.GetType() == expr.return_type);
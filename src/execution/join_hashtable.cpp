@@ -1,10 +1,12 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/prefetch.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -29,10 +31,10 @@ JoinHashTable::InsertState::InsertState(const JoinHashTable &ht)
 	ht.data_collection->InitializeChunkState(chunk_state, ht.equality_predicate_columns);
 }
 
-JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition> &conditions_p,
+JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition> &conditions,
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
-    : buffer_manager(BufferManager::GetBufferManager(context)), conditions(conditions_p),
-      build_types(std::move(btypes)), output_columns(output_columns_p), entry_size(0), tuple_size(0),
+    : buffer_manager(BufferManager::GetBufferManager(context)), build_types(std::move(btypes)),
+      output_columns(output_columns_p), entry_size(0), tuple_size(0),
       vfound(Value::BOOLEAN(false)), join_type(type_p), finalized(false), has_null(false),
       radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 	for (idx_t i = 0; i < conditions.size(); ++i) {
@@ -178,6 +180,14 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 		ht_offsets[row_index] = ht_offset;
 	}
 
+	// for large hash tables, first issue all the (random) loads of the entries, so the cache misses overlap
+	const bool prefetch = ht->capacity > ht_entry_t::PREFETCH_THRESHOLD;
+	if (prefetch) {
+		for (idx_t i = 0; i < count; i++) {
+			DUCKDB_PREFETCH(entries + ht_offsets_dense[i]);
+		}
+	}
+
 	// have a dense loop to have as few instructions as possible while producing cache misses as this is the
 	// first location where we access the big entries array
 	for (idx_t i = 0; i < count; i++) {
@@ -256,6 +266,13 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
 		}
 
+		if (prefetch) {
+			// the rows are scattered over the data collection, so we also prefetch these before comparing the keys
+			for (idx_t i = 0; i < salt_match_count; i++) {
+				DUCKDB_PREFETCH(row_ptr_insert_to[state.salt_match_sel.get_index(i)]);
+			}
+		}
+
 		if (salt_match_count != 0) {
 			// Perform row comparisons, after function call salt_match_sel will point to the keys that match
 			idx_t key_match_count = ht->row_matcher_build.Match(keys, key_state.vector_data, state.salt_match_sel,
@@ -407,6 +424,19 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 
 	// We already called TupleDataCollection::ToUnifiedFormat, so we can AppendUnified here
 	sink_collection->AppendUnified(append_state, source_chunk, *current_sel, added_count);
+
+	// Sample the hashes of every few chunks so we can detect heavy hitters if the join has to go external
+	if (!sample_hashes || build_chunk_count++ % HASH_SAMPLE_CHUNK_INTERVAL != 0) {
+		return;
+	}
+	if (!hash_sample) {
+		hash_sample = make_uniq<ReservoirSample>(Allocator::DefaultAllocator(), HASH_SAMPLE_SIZE);
+	}
+	DataChunk sample_chunk;
+	sample_chunk.InitializeEmpty({LogicalType::HASH});
+	sample_chunk.data[0].Slice(hash_values, *current_sel, added_count);
+	sample_chunk.SetCardinality(added_count);
+	hash_sample->AddToReservoir(sample_chunk);
 }
 
 idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat> &vector_data,
@@ -571,7 +601,7 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
 	if (PropagatesBuildSide(ht.join_type)) {
 		// if we propagate the build side, we may have added rows with NULL keys to the HT
 		// these may need to be filtered out depending on the comparison type (exactly like PrepareKeys does)
-		for (idx_t col_idx = 0; col_idx < ht.conditions.size(); col_idx++) {
+		for (idx_t col_idx = 0; col_idx < ht.condition_types.size(); col_idx++) {
 			// if null values are NOT equal for this column we filter them out
 			if (ht.NullValuesAreEqual(col_idx)) {
 				continue;
@@ -730,6 +760,59 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 	} while (iterator.Next());
 }
 
+void JoinHashTable::InsertHashesIntoBloomFilter(BloomFilter &bloom_filter) {
+	D_ASSERT(!finalized && equality_types.size() == 1);
+	if (Count() == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::UNPIN_AFTER_DONE, false);
+	const auto row_locations = iterator.GetRowLocations();
+	do {
+		const auto count = iterator.GetCurrentChunkCount();
+		for (idx_t i = 0; i < count; i++) {
+			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
+		}
+		bloom_filter.Insert(hash_data, count);
+	} while (iterator.Next());
+}
+
+void JoinHashTable::Unfinalize() {
+	D_ASSERT(finalized);
+	if (Count() > 0) {
+		// Finalize overwrote the hashes in the rows with the pointers of the chains, recompute them from the keys
+		DataChunk keys;
+		keys.Initialize(Allocator::DefaultAllocator(), equality_types);
+		TupleDataChunkState key_state;
+		data_collection->InitializeChunkState(key_state, equality_predicate_columns);
+		Vector hashes(LogicalType::HASH);
+
+		TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::ALREADY_PINNED, false);
+		auto &chunk_state = iterator.GetChunkState();
+		const auto row_locations = iterator.GetRowLocations();
+		do {
+			const auto count = iterator.GetCurrentChunkCount();
+			keys.Reset();
+			data_collection->ResetCachedCastVectors(key_state, equality_predicate_columns);
+			data_collection->Gather(chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(), count,
+			                        equality_predicate_columns, keys, *FlatVector::IncrementalSelectionVector(),
+			                        key_state.cached_cast_vectors);
+			keys.SetCardinality(count);
+			Hash(keys, *FlatVector::IncrementalSelectionVector(), count, hashes);
+			hashes.Flatten(count);
+			const auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			for (idx_t i = 0; i < count; i++) {
+				Store<hash_t>(hash_data[i], row_locations[i] + pointer_offset);
+			}
+		} while (iterator.Next());
+	}
+	data_collection->Unpin();
+	hash_map.Reset();
+	finalized = false;
+}
+
 void JoinHashTable::InitializeScanStructure(ScanStructure &scan_structure, DataChunk &keys,
                                             TupleDataChunkState &key_state, const SelectionVector *&current_sel) {
 	D_ASSERT(Count() > 0); // should be handled before
@@ -1373,6 +1456,79 @@ idx_t JoinHashTable::GetTotalSize(const vector<unique_ptr<JoinHashTable>> &local
 	return GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
 }
 
+void JoinHashTable::GetSplittableSize(const vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
+                                      idx_t &max_partition_size, idx_t &max_partition_count) const {
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	vector<idx_t> partition_sizes(num_partitions, 0);
+	vector<idx_t> partition_counts(num_partitions, 0);
+	for (auto &ht : local_hts) {
+		ht->GetSinkCollection().GetSizesAndCounts(partition_sizes, partition_counts);
+	}
+
+	// Count how often each hash occurs in the samples, and estimate how often it occurs on the build side
+	unordered_map<hash_t, pair<idx_t, double>> sampled_hashes;
+	for (auto &ht : local_hts) {
+		if (!ht->hash_sample || !ht->hash_sample->reservoir_data_chunk) {
+			continue;
+		}
+		auto &sample_chunk = *ht->hash_sample->reservoir_data_chunk;
+		if (sample_chunk.size() == 0) {
+			continue;
+		}
+		// Every sampled hash represents this many build-side rows of this thread (not all chunks are sampled)
+		const auto weight =
+		    static_cast<double>(ht->GetSinkCollection().Count()) / static_cast<double>(sample_chunk.size());
+		const auto hashes = FlatVector::GetData<hash_t>(sample_chunk.data[0]);
+		for (idx_t i = 0; i < sample_chunk.size(); i++) {
+			auto &entry = sampled_hashes[hashes[i]];
+			entry.first++;
+			entry.second += weight;
+		}
+	}
+
+	// Estimate the number of rows of the heavy hitters in each partition that do not fit in max_ht_size by themselves.
+	// These are the only rows that are truly unsplittable: other keys can be moved to a partition that fits
+	vector<idx_t> heavy_hitter_counts(num_partitions, 0);
+	for (auto &entry : sampled_hashes) {
+		if (entry.second.first < HEAVY_HITTER_MIN_SAMPLE_COUNT) {
+			continue;
+		}
+		const auto partition_idx =
+		    (entry.first & RadixPartitioning::Mask(radix_bits)) >> RadixPartitioning::Shift(radix_bits);
+		if (partition_counts[partition_idx] == 0) {
+			continue;
+		}
+		const auto estimated_count =
+		    MinValue(LossyNumericCast<idx_t>(entry.second.second), partition_counts[partition_idx]);
+		const auto estimated_size = LossyNumericCast<idx_t>(static_cast<double>(partition_sizes[partition_idx]) *
+		                                                    static_cast<double>(estimated_count) /
+		                                                    static_cast<double>(partition_counts[partition_idx]));
+		if (estimated_size + PointerTableSize(estimated_count) <= max_ht_size) {
+			continue;
+		}
+		heavy_hitter_counts[partition_idx] += estimated_count;
+	}
+
+	idx_t max_partition_ht_size = 0;
+	max_partition_size = 0;
+	max_partition_count = 0;
+	for (idx_t i = 0; i < num_partitions; i++) {
+		if (partition_counts[i] == 0) {
+			continue;
+		}
+		const auto partition_count = partition_counts[i] - MinValue(heavy_hitter_counts[i], partition_counts[i]);
+		const auto partition_size = LossyNumericCast<idx_t>(static_cast<double>(partition_sizes[i]) *
+		                                                    static_cast<double>(partition_count) /
+		                                                    static_cast<double>(partition_counts[i]));
+		const auto partition_ht_size = partition_size + PointerTableSize(partition_count);
+		if (partition_ht_size > max_partition_ht_size) {
+			max_partition_ht_size = partition_ht_size;
+			max_partition_size = partition_size;
+			max_partition_count = partition_count;
+		}
+	}
+}
+
 idx_t JoinHashTable::GetRemainingSize() const {
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	auto &partitions = sink_collection->GetPartitions();
@@ -1383,6 +1539,10 @@ idx_t JoinHashTable::GetRemainingSize() const {
 		count += partitions[partition_idx]->Count();
 		data_size += partitions[partition_idx]->SizeInBytes();
 	}
+	for (auto &part : remaining_parts) {
+		count += part->Count();
+		data_size += part->SizeInBytes();
+	}
 
 	return data_size + PointerTableSize(count);
 }
@@ -1434,6 +1594,13 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		Reset();
 	}
 
+	if (!remaining_parts.empty()) {
+		// Continue with the next part of the partition that did not fit in memory
+		data_collection->Combine(*remaining_parts.back());
+		remaining_parts.pop_back();
+		return true;
+	}
+
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	if (partition_end == num_partitions) {
 		return false;
@@ -1451,7 +1618,7 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		auto incl_count = count + partitions[partition_idx]->Count();
 		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
 		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
-		if (count > 0 && incl_ht_size > max_ht_size) {
+		if (partition_idx > partition_start && incl_ht_size > max_ht_size) {
 			break;
 		}
 		count = incl_count;
@@ -1459,6 +1626,16 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	}
 	partition_end = partition_idx;
 
+	if (count > 0 && data_size + PointerTableSize(count) > max_ht_size && CanBuildInParts(join_type)) {
+		// The partition does not fit in memory by itself (e.g., due to a heavy hitter key), split it up in parts
+		// Each part is built and probed in a round of its own, so we never have to build more than max_ht_size
+		D_ASSERT(partition_end == partition_start + 1);
+		SplitPartition(*partitions[partition_start], max_ht_size);
+		data_collection->Combine(*remaining_parts.back());
+		remaining_parts.pop_back();
+		return true;
+	}
+
 	// Move the partitions to the main data collection
 	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
 		data_collection->Combine(*partitions[partition_idx]);
@@ -1468,6 +1645,52 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	return true;
 }
 
+bool JoinHashTable::CanBuildInParts(const JoinType join_type) {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+	case JoinType::RIGHT_ANTI:
+		return true;
+	default:
+		// The result for a probe-side row depends on whether it matches any build-side row
+		return false;
+	}
+}
+
+void JoinHashTable::SplitPartition(TupleDataCollection &partition, const idx_t max_ht_size) {
+	D_ASSERT(remaining_parts.empty());
+	const auto row_size = static_cast<double>(partition.SizeInBytes()) / static_cast<double>(partition.Count());
+
+	// Scan (and destroy) the partition, and re-append it to parts that fit in max_ht_size
+	TupleDataScanState scan_state;
+	partition.InitializeScan(scan_state, TupleDataPinProperties::DESTROY_AFTER_DONE);
+	DataChunk chunk;
+	partition.InitializeScanChunk(scan_state, chunk);
+	unique_ptr<TupleDataCollection> part;
+	TupleDataAppendState append_state;
+	while (partition.Scan(scan_state, chunk)) {
+		if (part) {
+			const auto part_count = part->Count() + chunk.size();
+			const auto part_size = LossyNumericCast<idx_t>(row_size * static_cast<double>(part_count));
+			if (part_size + PointerTableSize(part_count) > max_ht_size) {
+				part->FinalizePinState(append_state.pin_state);
+				remaining_parts.push_back(std::move(part));
+			}
+		}
+		if (!part) {
+			part = make_uniq<TupleDataCollection>(buffer_manager, layout);
+			part->InitializeAppend(append_state);
+		}
+		part->Append(append_state, chunk);
+	}
+	if (part) {
+		part->FinalizePinState(append_state.pin_state);
+		remaining_parts.push_back(std::move(part));
+	}
+	partition.Reset();
+}
+
 static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk &payload, Vector &hashes) {
 	spill_chunk.Reset();
 	idx_t spill_col_idx = 0;
@@ -1480,6 +1703,7 @@ static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk
 	}
 	spill_col_idx += payload.ColumnCount();
 	spill_chunk.data[spill_col_idx].Reference(hashes);
+	spill_chunk.SetCardinality(keys.size());
 }
 
 void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state,
@@ -1501,7 +1725,11 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
 
 	// can't probe these values right now, append to spill
-	spill_chunk.Slice(false_sel, false_count);
+	// if the partition is built in parts, the values we CAN probe right now also need to be probed against the
+	// remaining parts of the partition, so we spill those as well
+	if (remaining_parts.empty()) {
+		spill_chunk.Slice(false_sel, false_count);
+	}
 	spill_chunk.Verify();
 	probe_spill.Append(spill_chunk, spill_state);
 
@@ -1576,6 +1804,19 @@ void ProbeSpill::PrepareNextProbe() {
 				global_spill_collection->Combine(*partition);
 			}
 		}
+		if (ht.HasRemainingParts()) {
+			// The partition is built in parts, and has to be probed again for the remaining parts
+			// The consumer destroys the data that it scans, so we probe a copy, and keep the partition around
+			D_ASSERT(ht.partition_end == ht.partition_start + 1);
+			auto copy = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
+			ColumnDataAppendState append_state;
+			copy->InitializeAppend(append_state);
+			for (auto &chunk : global_spill_collection->Chunks()) {
+				copy->Append(append_state, chunk);
+			}
+			partitions[ht.partition_start] = std::move(global_spill_collection);
+			global_spill_collection = std::move(copy);
+		}
 	}
 	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
 	consumer->InitializeScan();
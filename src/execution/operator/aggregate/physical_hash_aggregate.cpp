@@ -448,7 +448,7 @@ SinkCombineResultType PhysicalHashAggregate::Combine(ExecutionContext &context,
 
 		auto &grouping = groupings[i];
 		auto &table = grouping.table_data;
-		table.Combine(context, *grouping_gstate.table_state, *grouping_lstate.table_state);
+		table.Combine(context, *grouping_gstate.table_state, *grouping_lstate.table_state, this);
 	}
 
 	return SinkCombineResultType::FINISHED;
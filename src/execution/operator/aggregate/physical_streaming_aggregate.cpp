@@ -0,0 +1,317 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/value_operations/value_operations.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+#ifdef DEBUG
+	// the groups are the first columns of the input
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		D_ASSERT(groups[group_idx]->GetExpressionType() == ExpressionType::BOUND_REF);
+		D_ASSERT(groups[group_idx]->Cast<BoundReferenceExpression>().index == group_idx);
+	}
+#endif
+}
+
+bool PhysicalStreamingAggregate::SupportsAggregates(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expression : aggregates) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.filter) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op);
+	~StreamingAggregateState() override;
+
+	//! Returns the aggregate states of the group in the given slot
+	data_ptr_t GetSlot(idx_t slot) {
+		return state_data.get() + slot * state_size;
+	}
+	//! Initializes the aggregate states of the groups in the given slots
+	void InitializeSlots(idx_t first_slot, idx_t count);
+	//! Finalizes the aggregates of the groups in the given slots into the result (starting at column result_idx)
+	void FinalizeSlots(idx_t first_slot, idx_t count, DataChunk &result, idx_t result_idx);
+	//! Destroys the aggregate states of the groups in the given slots
+	void DestroySlots(idx_t first_slot, idx_t count);
+	//! Moves the states of the open group (in slot 0) to the spare allocator, and resets the current allocator
+	void ResetAllocator();
+
+public:
+	//! The allocator for the aggregate states
+	unique_ptr<ArenaAllocator> allocator;
+	//! The allocator that the open group is moved to when the allocator is reset
+	unique_ptr<ArenaAllocator> spare_allocator;
+	//! The aggregates
+	vector<AggregateObject> aggregate_objects;
+	//! The size of the states of all aggregates of a group
+	idx_t state_size;
+	//! The states of the groups in the current chunk. Slot 0 holds the group that is open, the other slots hold the
+	//! groups that start in the current chunk
+	unsafe_unique_array<data_t> state_data;
+
+	//! Whether there is a group that is open, i.e., that can continue in the next chunk
+	bool has_open_group;
+	//! The group values of the open group
+	DataChunk open_group;
+
+	//! Whether the group changes at a row of the chunk
+	unsafe_unique_array<bool> group_changes;
+	//! The row at which each of the groups in the chunk starts
+	SelectionVector group_starts;
+	//! Selection vectors to compare each row with the previous row
+	SelectionVector previous_rows;
+	SelectionVector current_rows;
+	SelectionVector distinct_rows;
+	//! Pointers to the aggregate states of the rows
+	Vector addresses;
+	//! Pointers to the aggregate states that are finalized/destroyed
+	Vector slot_addresses;
+};
+
+StreamingAggregateState::StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op)
+    : allocator(make_uniq<ArenaAllocator>(Allocator::Get(context))),
+      spare_allocator(make_uniq<ArenaAllocator>(Allocator::Get(context))), state_size(0), has_open_group(false),
+      group_starts(STANDARD_VECTOR_SIZE + 1), previous_rows(STANDARD_VECTOR_SIZE),
+      current_rows(STANDARD_VECTOR_SIZE), distinct_rows(STANDARD_VECTOR_SIZE), addresses(LogicalType::POINTER),
+      slot_addresses(LogicalType::POINTER) {
+	for (auto &aggregate : op.aggregates) {
+		aggregate_objects.emplace_back(&aggregate->Cast<BoundAggregateExpression>());
+		state_size += aggregate_objects.back().payload_size;
+	}
+	// every row of a chunk can start a new group, and the group that is open before the chunk needs a slot too
+	state_data = make_unsafe_uniq_array_uninitialized<data_t>(MaxValue<idx_t>(state_size, 1) *
+	                                                           (STANDARD_VECTOR_SIZE + 1));
+
+	vector<LogicalType> group_types;
+	for (auto &group : op.groups) {
+		group_types.push_back(group->return_type);
+	}
+	open_group.Initialize(Allocator::Get(context), group_types, 1);
+
+	group_changes = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+		previous_rows.set_index(i, i);
+		current_rows.set_index(i, i + 1);
+	}
+}
+
+StreamingAggregateState::~StreamingAggregateState() {
+	if (has_open_group) {
+		DestroySlots(0, 1);
+	}
+}
+
+void StreamingAggregateState::InitializeSlots(idx_t first_slot, idx_t count) {
+	for (idx_t slot = first_slot; slot < first_slot + count; slot++) {
+		auto state_ptr = GetSlot(slot);
+		for (auto &aggregate : aggregate_objects) {
+			aggregate.function.initialize(aggregate.function, state_ptr);
+			state_ptr += aggregate.payload_size;
+		}
+	}
+}
+
+void StreamingAggregateState::FinalizeSlots(idx_t first_slot, idx_t count, DataChunk &result, idx_t result_idx) {
+	auto slot_pointers = FlatVector::GetData<data_ptr_t>(slot_addresses);
+	for (idx_t i = 0; i < count; i++) {
+		slot_pointers[i] = GetSlot(first_slot + i);
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_objects.size(); aggr_idx++) {
+		auto &aggregate = aggregate_objects[aggr_idx];
+		AggregateInputData aggr_input_data(aggregate.GetFunctionData(), *allocator);
+		aggregate.function.finalize(slot_addresses, aggr_input_data, result.data[result_idx + aggr_idx], count, 0);
+		VectorOperations::AddInPlace(slot_addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+	}
+}
+
+void StreamingAggregateState::DestroySlots(idx_t first_slot, idx_t count) {
+	auto slot_pointers = FlatVector::GetData<data_ptr_t>(slot_addresses);
+	for (idx_t i = 0; i < count; i++) {
+		slot_pointers[i] = GetSlot(first_slot + i);
+	}
+	for (auto &aggregate : aggregate_objects) {
+		if (aggregate.function.destructor) {
+			AggregateInputData aggr_input_data(aggregate.GetFunctionData(), *allocator);
+			aggregate.function.destructor(slot_addresses, aggr_input_data, count);
+		}
+		VectorOperations::AddInPlace(slot_addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+	}
+}
+
+void StreamingAggregateState::ResetAllocator() {
+	// the states of the open group can reference memory of the allocator: combine them into fresh states (in slot 1)
+	// that allocate from the spare allocator, after which nothing references the current allocator anymore
+	InitializeSlots(1, 1);
+	Vector source_address(Value::POINTER(CastPointerToValue(GetSlot(0))));
+	Vector target_address(Value::POINTER(CastPointerToValue(GetSlot(1))));
+	for (auto &aggregate : aggregate_objects) {
+		AggregateInputData aggr_input_data(aggregate.GetFunctionData(), *spare_allocator);
+		aggregate.function.combine(source_address, target_address, aggr_input_data, 1);
+		VectorOperations::AddInPlace(source_address, UnsafeNumericCast<int64_t>(aggregate.payload_size), 1);
+		VectorOperations::AddInPlace(target_address, UnsafeNumericCast<int64_t>(aggregate.payload_size), 1);
+	}
+	DestroySlots(0, 1);
+	memcpy(GetSlot(0), GetSlot(1), state_size);
+
+	allocator->Reset();
+	std::swap(allocator, spare_allocator);
+}
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	const auto group_count = groups.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// Figure out at which rows the group changes: the first row is compared with the open group (if any) ...
+	auto group_changes = state.group_changes.get();
+	std::fill_n(group_changes, count, false);
+	group_changes[0] = !state.has_open_group;
+	for (idx_t col_idx = 0; col_idx < group_count && !group_changes[0]; col_idx++) {
+		group_changes[0] = !ValueOperations::NotDistinctFrom(state.open_group.GetValue(col_idx, 0),
+		                                                     input.GetValue(col_idx, 0));
+	}
+	// ... and the other rows with the row before them
+	if (count > 1) {
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			Vector previous(input.data[col_idx], state.previous_rows, count - 1);
+			Vector current(input.data[col_idx], state.current_rows, count - 1);
+			const auto distinct_count =
+			    VectorOperations::DistinctFrom(previous, current, nullptr, count - 1, &state.distinct_rows, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				group_changes[state.distinct_rows.get_index(i) + 1] = true;
+			}
+		}
+	}
+
+	// Assign a slot to each row: rows that continue the open group get slot 0, every new group gets the next slot
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	idx_t last_slot = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (group_changes[i]) {
+			last_slot++;
+			state.group_starts.set_index(last_slot, i);
+		}
+		addresses[i] = state.GetSlot(last_slot);
+	}
+	state.InitializeSlots(1, last_slot);
+
+	// Update the aggregates
+	idx_t payload_idx = group_count;
+	for (auto &aggregate : state.aggregate_objects) {
+		auto payload = aggregate.child_count == 0 ? nullptr : &input.data[payload_idx];
+		AggregateInputData aggr_input_data(aggregate.GetFunctionData(), *state.allocator);
+		aggregate.function.update(payload, aggr_input_data, aggregate.child_count, state.addresses, count);
+		VectorOperations::AddInPlace(state.addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+		payload_idx += aggregate.child_count;
+	}
+
+	// All groups except for the last one are complete: emit them
+	const auto first_complete_slot = idx_t(state.has_open_group ? 0 : 1);
+	if (last_slot > first_complete_slot) {
+		const auto complete_count = last_slot - first_complete_slot;
+		if (first_complete_slot == 0) {
+			// the group that was open before this chunk is complete
+			for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+				VectorOperations::Copy(state.open_group.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+			}
+		}
+		// the groups that start (and end) in this chunk
+		const auto output_offset = idx_t(first_complete_slot == 0 ? 1 : 0);
+		SelectionVector starts(state.group_starts.data() + 1);
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			VectorOperations::Copy(input.data[col_idx], chunk.data[col_idx], starts, last_slot - 1, 0, output_offset);
+		}
+		state.FinalizeSlots(first_complete_slot, complete_count, chunk, group_count);
+		chunk.SetCardinality(complete_count);
+		state.DestroySlots(first_complete_slot, complete_count);
+	}
+
+	// The last group remains open: move its states to slot 0, and store its group values
+	if (last_slot > 0) {
+		memcpy(state.GetSlot(0), state.GetSlot(last_slot), state.state_size);
+		state.open_group.Reset();
+		for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+			VectorOperations::Copy(input.data[col_idx], state.open_group.data[col_idx], count, count - 1, 0);
+		}
+		state.open_group.SetCardinality(1);
+		state.has_open_group = true;
+		// the states of the groups that were emitted are destroyed: free up the memory they allocated
+		if (state.allocator->SizeInBytes() > 0) {
+			state.ResetAllocator();
+		}
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_open_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	// Emit the group that is still open
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(state.open_group.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+	}
+	state.FinalizeSlots(0, 1, chunk, groups.size());
+	chunk.SetCardinality(1);
+	state.DestroySlots(0, 1);
+	state.has_open_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+InsertionOrderPreservingMap<string> PhysicalStreamingAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+	}
+	result["Aggregates"] = aggregate_info;
+	SetEstimatedCardinality(result, estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
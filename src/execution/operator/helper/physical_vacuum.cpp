@@ -4,6 +4,9 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -99,7 +102,22 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 
 SourceResultType PhysicalVacuum::GetData(ExecutionContext &context, DataChunk &chunk,
                                          OperatorSourceInput &input) const {
-	// NOP
+	if (!info->options.full) {
+		// NOP
+		return SourceResultType::FINISHED;
+	}
+	// VACUUM FULL: relocate the data of the database towards the start of the file and truncate the file
+	auto &client = context.client;
+	optional_ptr<AttachedDatabase> db;
+	if (table) {
+		db = table->catalog.GetAttached();
+	} else {
+		db = DatabaseManager::Get(client).GetDatabase(client, DatabaseManager::GetDefaultDatabase(client));
+	}
+	if (!db || !db->GetCatalog().IsDuckCatalog()) {
+		throw NotImplementedException("VACUUM FULL is only supported for DuckDB databases");
+	}
+	DuckTransactionManager::Get(*db).DefragmentCheckpoint(client);
 	return SourceResultType::FINISHED;
 }
 
@@ -0,0 +1,244 @@
+#include "duckdb/execution/operator/join/join_build_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+JoinBuildCacheEntry::JoinBuildCacheEntry() : commit_version(0), size(0) {
+}
+
+JoinBuildCacheEntry::~JoinBuildCacheEntry() {
+}
+
+JoinBuildCache::~JoinBuildCache() {
+}
+
+static void AppendToFingerprint(string &fingerprint, const string &text) {
+	fingerprint += to_string(text.size()) + ":" + text;
+}
+
+template <class T>
+static void AppendSerializedToFingerprint(string &fingerprint, const T &object) {
+	MemoryStream stream;
+	BinarySerializer::Serialize(object, stream);
+	AppendToFingerprint(fingerprint, string(char_ptr_cast(stream.GetData()), stream.GetPosition()));
+}
+
+static void AppendToFingerprint(string &fingerprint, const vector<idx_t> &indices) {
+	AppendToFingerprint(fingerprint, to_string(indices.size()));
+	for (auto &index : indices) {
+		AppendToFingerprint(fingerprint, to_string(index));
+	}
+}
+
+static bool AppendExpressionToFingerprint(string &fingerprint, const Expression &expr) {
+	if (!expr.IsConsistent() || expr.HasParameter() || expr.HasSubquery()) {
+		// the result of the expression might be different in the next query
+		return false;
+	}
+	// the alias and query location do not affect the result - leave them out so that they do not prevent reuse
+	auto copy = expr.Copy();
+	ExpressionIterator::EnumerateExpression(copy, [&](Expression &child) {
+		child.alias.clear();
+		child.query_location = optional_idx();
+	});
+	AppendSerializedToFingerprint(fingerprint, *copy);
+	return true;
+}
+
+JoinBuildCacheKey JoinBuildCache::GetKey(ClientContext &context, const PhysicalHashJoin &op) {
+	JoinBuildCacheKey result;
+	if (!ClientConfig::GetConfig(context).enable_join_build_cache) {
+		return result;
+	}
+	switch (op.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+	case JoinType::MARK:
+		// these join types do not modify the hash table while probing, so it can be shared between queries
+		break;
+	default:
+		return result;
+	}
+	if (!op.delim_types.empty()) {
+		// correlated MARK joins keep per-query state in the hash table
+		return result;
+	}
+
+	string fingerprint;
+	try {
+		AppendToFingerprint(fingerprint, EnumUtil::ToString(op.join_type));
+		for (auto &condition : op.conditions) {
+			AppendToFingerprint(fingerprint, EnumUtil::ToString(condition.comparison));
+			if (!AppendExpressionToFingerprint(fingerprint, *condition.right)) {
+				return result;
+			}
+		}
+		AppendToFingerprint(fingerprint, op.payload_column_idxs);
+		AppendToFingerprint(fingerprint, op.rhs_output_columns);
+
+		// the build side must be a chain of filters and projections over a table scan
+		optional_ptr<const PhysicalTableScan> scan;
+		reference<const PhysicalOperator> node = *op.children[1];
+		while (!scan) {
+			AppendToFingerprint(fingerprint, PhysicalOperatorToString(node.get().type));
+			switch (node.get().type) {
+			case PhysicalOperatorType::PROJECTION:
+				for (auto &expr : node.get().Cast<PhysicalProjection>().select_list) {
+					if (!AppendExpressionToFingerprint(fingerprint, *expr)) {
+						return result;
+					}
+				}
+				break;
+			case PhysicalOperatorType::FILTER:
+				if (!AppendExpressionToFingerprint(fingerprint, *node.get().Cast<PhysicalFilter>().expression)) {
+					return result;
+				}
+				break;
+			case PhysicalOperatorType::TABLE_SCAN:
+				scan = node.get().Cast<PhysicalTableScan>();
+				continue;
+			default:
+				return result;
+			}
+			node = *node.get().children[0];
+		}
+
+		// only plain scans of DuckDB tables are cached - filters that are pushed into the scan at runtime by other
+		// joins can be different in every query
+		if (scan->function.name != "seq_scan" || !scan->function.get_bind_info || scan->dynamic_filters ||
+		    !scan->parameters.empty()) {
+			return result;
+		}
+		auto table = scan->function.get_bind_info(scan->bind_data.get()).table;
+		if (!table || !table->IsDuckTable()) {
+			return result;
+		}
+		AppendToFingerprint(fingerprint, table->ParentCatalog().GetName());
+		AppendToFingerprint(fingerprint, table->ParentSchema().name);
+		AppendToFingerprint(fingerprint, table->name);
+		AppendToFingerprint(fingerprint, to_string(table->oid));
+		AppendToFingerprint(fingerprint, scan->column_ids);
+		AppendToFingerprint(fingerprint, scan->projection_ids);
+		if (scan->table_filters) {
+			AppendSerializedToFingerprint(fingerprint, *scan->table_filters);
+		}
+
+		// the cached hash table can only be used if this transaction sees exactly the state after the last write:
+		// (1) this transaction has not made any changes, and (2) no write has been committed since it started
+		auto &transaction = DuckTransaction::Get(context, table->ParentCatalog());
+		auto &transaction_manager = DuckTransactionManager::Get(table->ParentCatalog().GetAttached());
+		auto last_write_commit = transaction_manager.GetLastWriteCommit();
+		if (transaction.ChangesMade() || last_write_commit >= transaction.start_time) {
+			return result;
+		}
+		result.commit_version = last_write_commit;
+		result.table_info = table->GetStorage().GetDataTableInfo();
+		result.transaction = transaction;
+	} catch (NotImplementedException &ex) {
+		// not all expressions can be serialized
+		return result;
+	}
+	result.fingerprint = "join_build_cache:" + fingerprint;
+	return result;
+}
+
+JoinBuildCache &JoinBuildCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<JoinBuildCache>(JoinBuildCache::ObjectType());
+}
+
+unique_ptr<JoinBuildCacheEntry> JoinBuildCache::RemoveEntry(const string &fingerprint) {
+	auto it = entries.find(fingerprint);
+	D_ASSERT(it != entries.end());
+	auto entry = std::move(it->second);
+	entries.erase(it);
+	lru.erase(entry->lru_position);
+	total_size -= entry->size;
+	return entry;
+}
+
+unique_ptr<JoinBuildCacheEntry> JoinBuildCache::Take(ClientContext &context, const JoinBuildCacheKey &key,
+                                                     optional_ptr<const JoinFilterPushdownInfo> filter_pushdown) {
+	D_ASSERT(key.IsCacheable());
+	auto &cache = Get(context);
+	lock_guard<mutex> guard(cache.lock);
+	auto it = cache.entries.find(key.fingerprint);
+	if (it == cache.entries.end()) {
+		return nullptr;
+	}
+	auto &entry = *it->second;
+	if (entry.commit_version != key.commit_version || entry.table_info.lock().get() != key.table_info.get()) {
+		if (entry.commit_version < key.commit_version) {
+			// the database has been written to since the hash table was built: it is stale
+			cache.RemoveEntry(key.fingerprint);
+		}
+		return nullptr;
+	}
+	if (filter_pushdown && entry.hash_table->Count() > 0) {
+		for (auto &filter : filter_pushdown->filters) {
+			if (entry.filters.find(filter.join_condition) == entry.filters.end()) {
+				// the hash table was built without generating the filters that this join pushes into the probe side
+				return nullptr;
+			}
+		}
+	}
+	return cache.RemoveEntry(key.fingerprint);
+}
+
+bool JoinBuildCache::Store(ClientContext &context, const JoinBuildCacheKey &key, shared_ptr<JoinHashTable> hash_table,
+                           join_filter_map_t filters) {
+	D_ASSERT(key.IsCacheable());
+	auto transaction = key.transaction;
+	if (transaction->ChangesMade()) {
+		// the query made changes while building the hash table
+		return false;
+	}
+	auto max_size = DBConfig::GetConfig(context).options.join_build_cache_size;
+	auto size = hash_table->GetDataCollection().SizeInBytes();
+	if (size > max_size) {
+		return false;
+	}
+	// unpin the data so that it can be spilled to disk while the hash table is in the cache
+	hash_table->Unfinalize();
+
+	auto entry = make_uniq<JoinBuildCacheEntry>();
+	entry->hash_table = std::move(hash_table);
+	entry->filters = std::move(filters);
+	entry->commit_version = key.commit_version;
+	entry->table_info = key.table_info;
+	entry->size = size;
+
+	auto &cache = Get(context);
+	lock_guard<mutex> guard(cache.lock);
+	if (cache.entries.find(key.fingerprint) != cache.entries.end()) {
+		cache.RemoveEntry(key.fingerprint);
+	}
+	// evict the least recently used entries until the new entry fits
+	while (!cache.lru.empty() && cache.total_size + size > max_size) {
+		auto fingerprint = cache.lru.front();
+		cache.RemoveEntry(fingerprint);
+	}
+	entry->lru_position = cache.lru.insert(cache.lru.end(), key.fingerprint);
+	cache.total_size += size;
+	cache.entries[key.fingerprint] = std::move(entry);
+	return true;
+}
+
+} // namespace duckdb
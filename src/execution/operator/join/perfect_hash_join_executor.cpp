@@ -14,26 +14,93 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 	return perfect_join_statistics.is_build_small;
 }
 
+//===--------------------------------------------------------------------===//
+// Slots
+//===--------------------------------------------------------------------===//
+void PerfectHashJoinExecutor::ComputeSlots(DataChunk &keys, idx_t count, idx_t slots[], bool in_range[]) const {
+	for (idx_t i = 0; i < count; i++) {
+		slots[i] = 0;
+		in_range[i] = true;
+	}
+	for (idx_t key_idx = 0; key_idx < keys.ColumnCount(); key_idx++) {
+		ComputeSlotsSwitch(keys.data[key_idx], key_idx, count, slots, in_range);
+	}
+}
+
+void PerfectHashJoinExecutor::ComputeSlotsSwitch(Vector &source, idx_t key_idx, idx_t count, idx_t slots[],
+                                                 bool in_range[]) const {
+	switch (source.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedComputeSlots<int8_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::INT16:
+		return TemplatedComputeSlots<int16_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::INT32:
+		return TemplatedComputeSlots<int32_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::INT64:
+		return TemplatedComputeSlots<int64_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::UINT8:
+		return TemplatedComputeSlots<uint8_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::UINT16:
+		return TemplatedComputeSlots<uint16_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::UINT32:
+		return TemplatedComputeSlots<uint32_t>(source, key_idx, count, slots, in_range);
+	case PhysicalType::UINT64:
+		return TemplatedComputeSlots<uint64_t>(source, key_idx, count, slots, in_range);
+	default:
+		throw NotImplementedException("Type not supported for perfect hash join");
+	}
+}
+
+template <typename T>
+void PerfectHashJoinExecutor::TemplatedComputeSlots(Vector &source, idx_t key_idx, idx_t count, idx_t slots[],
+                                                    bool in_range[]) const {
+	auto min_value = perfect_join_statistics.build_min[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.build_max[key_idx].GetValueUnsafe<T>();
+	auto multiplier = perfect_join_statistics.key_multipliers[key_idx];
+
+	UnifiedVectorFormat vector_data;
+	source.ToUnifiedFormat(count, vector_data);
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	for (idx_t i = 0; i < count; i++) {
+		auto data_idx = vector_data.sel->get_index(i);
+		if (!vector_data.validity.RowIsValid(data_idx)) {
+			in_range[i] = false;
+			continue;
+		}
+		auto input_value = data[data_idx];
+		if (input_value < min_value || input_value > max_value) {
+			in_range[i] = false;
+			continue;
+		}
+		// subtract min value to get the position within the range of this key
+		slots[i] += (idx_t)(input_value - min_value) * multiplier;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
-	// First, allocate memory for each build column
-	auto build_size = perfect_join_statistics.build_range + 1;
-	for (const auto &type : join.rhs_output_types) {
-		perfect_hash_table.emplace_back(type, build_size);
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
+	if (perfect_join_statistics.build_min.size() != join.conditions.size()) {
+		return false;
+	}
+	for (idx_t key_idx = 0; key_idx < join.conditions.size(); key_idx++) {
+		if (perfect_join_statistics.build_min[key_idx].IsNull() ||
+		    perfect_join_statistics.build_max[key_idx].IsNull()) {
+			return false;
+		}
 	}
 
-	// and for duplicate_checking
+	// allocate memory for duplicate checking
+	auto build_size = perfect_join_statistics.build_range + 1;
 	bitmap_build_idx = make_unsafe_uniq_array_uninitialized<bool>(build_size);
 	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
 
 	// Now fill columns with build data
-
-	return FullScanHashTable(key_type);
+	return FullScanHashTable();
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable() {
 	auto &data_collection = ht.GetDataCollection();
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
@@ -48,93 +115,75 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 		key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
 	}
 
-	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+	// Scan the build keys in the hash table, and compute their slots
+	DataChunk build_keys;
+	build_keys.Initialize(Allocator::DefaultAllocator(), join.condition_types, MaxValue<idx_t>(key_count, 1));
+	for (idx_t key_idx = 0; key_idx < build_keys.ColumnCount(); key_idx++) {
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_keys.data[key_idx], key_count, key_idx);
+	}
+	build_keys.SetCardinality(key_count);
+	auto slots = make_unsafe_uniq_array_uninitialized<idx_t>(MaxValue<idx_t>(key_count, 1));
+	auto in_range = make_unsafe_uniq_array_uninitialized<bool>(MaxValue<idx_t>(key_count, 1));
+	ComputeSlots(build_keys, key_count, slots.get(), in_range.get());
 
 	// Now fill the selection vector using the build keys and create a sequential vector
 	// TODO: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(key_count + 1);
 	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
-
-	// early out
-	if (!success) {
-		return false;
+	idx_t row_count = 0;
+	for (idx_t i = 0; i < key_count; i++) {
+		if (!in_range[i]) {
+			// do not consider keys out of the range
+			continue;
+		}
+		const auto slot = slots[i];
+		if (bitmap_build_idx[slot]) {
+			has_duplicates = true;
+		} else {
+			bitmap_build_idx[slot] = true;
+			unique_keys++;
+		}
+		sel_build.set_index(row_count, slot);
+		sel_tuples.set_index(row_count++, i);
 	}
-	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
+
+	const auto build_size = perfect_join_statistics.build_range + 1;
+	idx_t table_size = build_size;
+	if (has_duplicates) {
+		if (row_count > MAX_DUPLICATE_BUILD_SIZE) {
+			return false;
+		}
+		// group the rows by slot: count the rows of each slot, and compute the offsets using a prefix sum
+		build_offsets = make_unsafe_uniq_array<idx_t>(build_size + 1);
+		for (idx_t i = 0; i < row_count; i++) {
+			build_offsets[sel_build.get_index(i) + 1]++;
+		}
+		for (idx_t slot = 0; slot < build_size; slot++) {
+			build_offsets[slot + 1] += build_offsets[slot];
+		}
+		auto insert_offsets = make_unsafe_uniq_array_uninitialized<idx_t>(build_size);
+		memcpy(insert_offsets.get(), build_offsets.get(), sizeof(idx_t) * build_size);
+		for (idx_t i = 0; i < row_count; i++) {
+			sel_build.set_index(i, insert_offsets[sel_build.get_index(i)]++);
+		}
+		table_size = MaxValue<idx_t>(row_count, 1);
+	} else if (unique_keys == build_size && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
-	key_count = unique_keys; // do not consider keys out of the range
 
 	// Full scan the remaining build columns and fill the perfect hash table
-	const auto build_size = perfect_join_statistics.build_range + 1;
 	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
+		perfect_hash_table.emplace_back(join.rhs_output_types[i], table_size);
 		auto &vector = perfect_hash_table[i];
 		const auto output_col_idx = ht.output_columns[i];
 		D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
-		if (build_size > STANDARD_VECTOR_SIZE) {
+		if (table_size > STANDARD_VECTOR_SIZE) {
 			auto &col_mask = FlatVector::Validity(vector);
-			col_mask.Initialize(build_size);
+			col_mask.Initialize(table_size);
 		}
-		data_collection.Gather(tuples_addresses, sel_tuples, key_count, output_col_idx, vector, sel_build, nullptr);
-	}
-
-	return true;
-}
-
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
-	default:
-		throw NotImplementedException("Type not supported for perfect hash join");
+		data_collection.Gather(tuples_addresses, sel_tuples, row_count, output_col_idx, vector, sel_build, nullptr);
 	}
-}
 
-template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
-		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
-		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
-		}
-	}
 	return true;
 }
 
@@ -150,14 +199,23 @@ public:
 		}
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
-		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
+		slots = make_unsafe_uniq_array_uninitialized<idx_t>(STANDARD_VECTOR_SIZE);
+		in_range = make_unsafe_uniq_array_uninitialized<bool>(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
-	SelectionVector seq_sel_vec;
+	//! The slot of each of the probe keys, and whether it is within the build-side range
+	unsafe_unique_array<idx_t> slots;
+	unsafe_unique_array<bool> in_range;
+
+	//! Whether we are still producing the matches of the current input chunk (only if keys occur more than once)
+	bool has_more_output = false;
+	//! The probe row, and the match of that row, to continue from
+	idx_t probe_position = 0;
+	idx_t match_position = 0;
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -168,17 +226,25 @@ unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionCon
 OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &result, OperatorState &state_p) {
 	auto &state = state_p.Cast<PerfectHashJoinState>();
-	// keeps track of how many probe keys have a match
-	idx_t probe_sel_count = 0;
+	if (!state.has_more_output) {
+		// fetch the join keys from the chunk, and compute their slots
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		ComputeSlots(state.join_keys, state.join_keys.size(), state.slots.get(), state.in_range.get());
+	}
+	if (has_duplicates) {
+		return ProbeDuplicates(input, result, state);
+	}
 
-	// fetch the join keys from the chunk
-	state.join_keys.Reset();
-	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
+	// select the keys that have a match in the build side
 	auto keys_count = state.join_keys.size();
-	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	idx_t probe_sel_count = 0;
+	for (idx_t i = 0; i < keys_count; i++) {
+		if (state.in_range[i] && bitmap_build_idx[state.slots[i]]) {
+			state.build_sel_vec.set_index(probe_sel_count, state.slots[i]);
+			state.probe_sel_vec.set_index(probe_sel_count++, i);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -198,87 +264,48 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+OperatorResultType PerfectHashJoinExecutor::ProbeDuplicates(DataChunk &input, DataChunk &result,
+                                                            OperatorState &state_p) {
+	auto &state = state_p.Cast<PerfectHashJoinState>();
+	auto keys_count = state.join_keys.size();
 
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
+	// emit a (probe row, build row) pair for each of the matches, until the result is full
+	idx_t result_count = 0;
+	while (state.probe_position < keys_count && result_count < STANDARD_VECTOR_SIZE) {
+		const auto i = state.probe_position;
+		if (!state.in_range[i] || !bitmap_build_idx[state.slots[i]]) {
+			state.probe_position++;
+			continue;
 		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
+		const auto slot = state.slots[i];
+		auto match_idx = build_offsets[slot] + state.match_position;
+		const auto match_end = build_offsets[slot + 1];
+		for (; match_idx < match_end && result_count < STANDARD_VECTOR_SIZE; match_idx++) {
+			state.build_sel_vec.set_index(result_count, match_idx);
+			state.probe_sel_vec.set_index(result_count++, i);
 		}
+		if (match_idx < match_end) {
+			// the result is full: continue with the remaining matches of this row
+			state.match_position = match_idx - build_offsets[slot];
+		} else {
+			state.match_position = 0;
+			state.probe_position++;
+		}
+	}
+	state.has_more_output = state.probe_position < keys_count;
+	if (!state.has_more_output) {
+		state.probe_position = 0;
+	}
+
+	result.Slice(input, state.probe_sel_vec, result_count, 0);
+	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
+		auto &result_vector = result.data[input.ColumnCount() + i];
+		D_ASSERT(result_vector.GetType() == ht.layout.GetTypes()[ht.output_columns[i]]);
+		auto &build_vec = perfect_hash_table[i];
+		result_vector.Reference(build_vec);
+		result_vector.Slice(state.build_sel_vec, result_count);
 	}
+	return state.has_more_output ? OperatorResultType::HAVE_MORE_OUTPUT : OperatorResultType::NEED_MORE_INPUT;
 }
 
 } // namespace duckdb
@@ -1,8 +1,11 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
+#include "duckdb/execution/operator/join/join_build_cache.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -14,12 +17,15 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 
 namespace duckdb {
 
@@ -102,10 +108,14 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
                                                                          const PhysicalOperator &op) const {
 	// clear any previously set filters
 	// we can have previous filters for this operator in case of e.g. recursive CTEs
-	dynamic_filters->ClearFilters(op);
+	for (auto &filter : filters) {
+		filter.dynamic_filters->ClearFilters(op);
+	}
 	auto result = make_uniq<JoinFilterGlobalState>();
 	result->global_aggregate_state =
 	    make_uniq<GlobalUngroupedAggregateState>(BufferAllocator::Get(context), min_max_aggregates);
+	result->bloom_filter_threshold = ClientConfig::GetConfig(context).join_bloom_filter_threshold;
+	result->in_filter_threshold = ClientConfig::GetConfig(context).join_in_filter_threshold;
 	return result;
 }
 
@@ -116,7 +126,18 @@ public:
 	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
-		hash_table = op.InitializeHashTable(context);
+		build_cache_key = JoinBuildCache::GetKey(context, op);
+		unique_ptr<JoinBuildCacheEntry> build_cache_entry;
+		if (build_cache_key.IsCacheable()) {
+			build_cache_entry = JoinBuildCache::Take(context, build_cache_key, op.filter_pushdown.get());
+		}
+		cached_build = build_cache_entry != nullptr;
+		if (cached_build) {
+			hash_table = std::move(build_cache_entry->hash_table);
+			join_filters = std::move(build_cache_entry->filters);
+		} else {
+			hash_table = op.InitializeHashTable(context);
+		}
 
 		// For perfect hash join
 		perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table, op.perfect_join_statistics);
@@ -135,6 +156,8 @@ public:
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Returns the HT to the join build cache once the probe is done, returns false if the cache did not take it
+	bool StoreInBuildCache();
 
 public:
 	ClientContext &context;
@@ -144,8 +167,16 @@ public:
 	//! Temporary memory state for managing this operator's memory usage
 	unique_ptr<TemporaryMemoryState> temporary_memory_state;
 
-	//! Global HT used by the join
-	unique_ptr<JoinHashTable> hash_table;
+	//! Global HT used by the join (shared with the join build cache once the probe is done, if it is cached)
+	shared_ptr<JoinHashTable> hash_table;
+	//! The key of the build side in the join build cache
+	JoinBuildCacheKey build_cache_key;
+	//! Whether the HT was taken from the join build cache, i.e., the build side does not need to be built
+	bool cached_build;
+	//! Whether the HT should be stored in the join build cache once the probe is done
+	bool store_in_build_cache = false;
+	//! The filters that were generated from the build side (kept for the join build cache)
+	join_filter_map_t join_filters;
 	//! The perfect hash join executor (if any)
 	unique_ptr<PerfectHashJoinExecutor> perfect_join_executor;
 	//! Whether or not the hash table has been finalized
@@ -175,6 +206,7 @@ public:
 unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(JoinFilterGlobalState &gstate) const {
 	auto result = make_uniq<JoinFilterLocalState>();
 	result->local_aggregate_state = make_uniq<LocalUngroupedAggregateState>(*gstate.global_aggregate_state);
+	result->in_filter_threshold = gstate.in_filter_threshold;
 	return result;
 }
 
@@ -195,6 +227,10 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+		if (!gstate.cached_build && JoinHashTable::CanBuildInParts(op.join_type)) {
+			// Only joins that can build a skewed partition in parts if they go external benefit from the sample
+			hash_table->EnableHashSample();
+		}
 
 		gstate.active_local_states++;
 
@@ -285,9 +321,26 @@ void JoinFilterPushdownInfo::Sink(DataChunk &chunk, JoinFilterLocalState &lstate
 			lstate.local_aggregate_state->Sink(chunk, pushdown.join_condition, aggr_idx);
 		}
 	}
+	if (lstate.in_filter_threshold > 0) {
+		// keep track of the keys while the build side is small enough to generate IN filters
+		if (!lstate.in_filter_keys) {
+			lstate.in_filter_keys = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), chunk.GetTypes());
+		}
+		if (lstate.in_filter_keys->Count() + chunk.size() > lstate.in_filter_threshold) {
+			lstate.in_filter_threshold = 0;
+			lstate.in_filter_keys.reset();
+		} else {
+			lstate.in_filter_keys->Append(chunk);
+		}
+	}
 }
 
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<HashJoinGlobalSinkState>();
+	if (gstate.cached_build) {
+		// we already have the finalized HT, no need to read the rest of the build side
+		return SinkResultType::FINISHED;
+	}
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
 	// resolve the join keys for the right chunk
@@ -319,6 +372,24 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 
 void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
 	gstate.global_aggregate_state->Combine(*lstate.local_aggregate_state);
+
+	lock_guard<mutex> guard(gstate.lock);
+	if (gstate.in_filter_threshold > 0) {
+		if (lstate.in_filter_threshold == 0) {
+			// the local build side exceeds the threshold - we cannot generate IN filters
+			gstate.in_filter_threshold = 0;
+			gstate.in_filter_keys.reset();
+		} else if (!lstate.in_filter_keys) {
+			// nothing was sunk into this local state
+		} else if (!gstate.in_filter_keys) {
+			gstate.in_filter_keys = std::move(lstate.in_filter_keys);
+		} else if (gstate.in_filter_keys->Count() + lstate.in_filter_keys->Count() > gstate.in_filter_threshold) {
+			gstate.in_filter_threshold = 0;
+			gstate.in_filter_keys.reset();
+		} else {
+			gstate.in_filter_keys->Combine(*lstate.in_filter_keys);
+		}
+	}
 }
 
 SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
@@ -376,8 +447,23 @@ static idx_t GetPartitioningSpaceRequirement(ClientContext &context, const vecto
 void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &global_state) const {
 	auto &gstate = global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *gstate.hash_table;
+	if (gstate.cached_build) {
+		// the HT was taken from the join build cache, we only have to construct the pointer table again
+		gstate.total_size = ht.GetDataCollection().SizeInBytes() + JoinHashTable::PointerTableSize(ht.Count());
+		gstate.temporary_memory_state->SetMinimumReservation(gstate.total_size);
+		gstate.temporary_memory_state->SetRemainingSize(gstate.total_size);
+		return;
+	}
 	gstate.total_size =
 	    ht.GetTotalSize(gstate.local_hash_tables, gstate.max_partition_size, gstate.max_partition_count);
+	if (filter_pushdown) {
+		// the Bloom filters are built while the HT is in memory, so we reserve memory for them as well
+		idx_t build_count = 0;
+		for (auto &local_ht : gstate.local_hash_tables) {
+			build_count += local_ht->GetSinkCollection().Count();
+		}
+		gstate.total_size += filter_pushdown->GetBloomFilterSize(*gstate.global_filter_state, ht, build_count);
+	}
 	bool all_constant;
 	gstate.temporary_memory_state->SetMaterializationPenalty(GetTupleWidth(children[0]->types, all_constant));
 	gstate.temporary_memory_state->SetRemainingSize(gstate.total_size);
@@ -461,6 +547,12 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 	event.InsertEvent(std::move(new_event));
 }
 
+bool HashJoinGlobalSinkState::StoreInBuildCache() {
+	D_ASSERT(store_in_build_cache);
+	store_in_build_cache = false;
+	return JoinBuildCache::Store(context, build_cache_key, hash_table, std::move(join_filters));
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	auto guard = Lock();
 	if (!probe_spill) {
@@ -550,9 +642,12 @@ public:
 		const auto probe_side_requirement =
 		    GetPartitioningSpaceRequirement(sink.context, op.types, sink.hash_table->GetRadixBits(), sink.num_threads);
 
-		sink.temporary_memory_state->SetMinimumReservation(sink.max_partition_size +
-		                                                   JoinHashTable::PointerTableSize(sink.max_partition_count) +
-		                                                   probe_side_requirement);
+		auto max_ht_size = sink.max_partition_size + JoinHashTable::PointerTableSize(sink.max_partition_count);
+		if (JoinHashTable::CanBuildInParts(op.join_type)) {
+			// Partitions that still do not fit (e.g., due to a heavy hitter key) are built and probed in parts
+			max_ht_size = MinValue(max_ht_size, sink.temporary_memory_state->GetReservation());
+		}
+		sink.temporary_memory_state->SetMinimumReservation(max_ht_size + probe_side_requirement);
 		sink.temporary_memory_state->UpdateReservation(executor.context);
 
 		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
@@ -560,7 +655,29 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+//! Whether a Bloom filter can be generated from the hashes in the HT for the given join condition
+static bool CanGenerateBloomFilter(JoinFilterGlobalState &gstate, const JoinHashTable &ht, idx_t join_condition,
+                                   idx_t build_count) {
+	if (gstate.bloom_filter_threshold == 0 || build_count > gstate.bloom_filter_threshold) {
+		// disabled, or too many rows on the build side - a Bloom filter would become too large to be worthwhile
+		return false;
+	}
+	// the HT hashes all equality conditions together - the hashes can only be used if this is the only one
+	return ht.equality_predicate_columns.size() == 1 && ht.equality_predicate_columns[0] == join_condition;
+}
+
+idx_t JoinFilterPushdownInfo::GetBloomFilterSize(JoinFilterGlobalState &gstate, const JoinHashTable &ht,
+                                                 idx_t build_count) const {
+	for (auto &filter : filters) {
+		if (CanGenerateBloomFilter(gstate, ht, filter.join_condition, build_count)) {
+			// filters with the same join condition share the Bloom filter, so there is at most one
+			return BloomFilter::GetSizeInBytes(build_count);
+		}
+	}
+	return 0;
+}
+
+join_filter_map_t JoinFilterPushdownInfo::GenerateFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -571,10 +688,15 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
-	// create a filter for each of the aggregates
+	// create the filters for each of the aggregates
+	join_filter_map_t result;
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
-		auto filter_col_idx = filter.probe_column_index.column_index;
+		if (result.find(filter.join_condition) != result.end()) {
+			// the same join condition can be pushed into multiple scans
+			continue;
+		}
+		auto &condition_filters = result[filter.join_condition];
 		auto min_idx = filter_idx * 2;
 		auto max_idx = min_idx + 1;
 
@@ -586,20 +708,62 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			// table e.g. because they are part of a RIGHT join
 			continue;
 		}
-		if (Value::NotDistinctFrom(min_val, max_val)) {
+		auto is_equality = Value::NotDistinctFrom(min_val, max_val);
+		if (is_equality) {
 			// min = max - generate an equality filter
-			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+			condition_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val)));
 		} else {
 			// min != max - generate a range filter
-			auto greater_equals =
-			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
-			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			condition_filters.push_back(
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val)));
+			condition_filters.push_back(
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val)));
 		}
 		// not null filter
-		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+		condition_filters.push_back(make_uniq<IsNotNullFilter>());
+		if (is_equality) {
+			// the equality filter is already exact
+			continue;
+		}
+		if (gstate.in_filter_keys) {
+			// the build side is small - generate an exact IN filter, which can also prune segments and row groups
+			value_set_t unique_values;
+			vector<Value> in_values;
+			for (auto &chunk : gstate.in_filter_keys->Chunks()) {
+				auto &keys = chunk.data[filter.join_condition];
+				for (idx_t i = 0; i < chunk.size(); i++) {
+					auto value = keys.GetValue(i);
+					if (!value.IsNull() && unique_values.insert(value).second) {
+						in_values.push_back(std::move(value));
+					}
+				}
+			}
+			condition_filters.push_back(make_uniq<InFilter>(std::move(in_values)));
+			continue;
+		}
+		if (!CanGenerateBloomFilter(gstate, ht, filter.join_condition, ht.Count())) {
+			continue;
+		}
+		// Bloom filter - this prunes probe-side rows that do not have a match, even when min/max prunes nothing
+		auto bloom_filter = make_uniq<BloomFilter>(ht.Count());
+		ht.InsertHashesIntoBloomFilter(*bloom_filter);
+		condition_filters.push_back(std::move(bloom_filter));
+	}
+	// the keys are no longer required
+	gstate.in_filter_keys.reset();
+	return result;
+}
+
+void JoinFilterPushdownInfo::PushFilters(const join_filter_map_t &join_filters, const PhysicalOperator &op) const {
+	for (auto &filter : filters) {
+		auto entry = join_filters.find(filter.join_condition);
+		if (entry == join_filters.end()) {
+			continue;
+		}
+		auto filter_col_idx = filter.probe_column_index.column_index;
+		for (auto &table_filter : entry->second) {
+			filter.dynamic_filters->PushFilter(op, filter_col_idx, table_filter->Copy());
+		}
 	}
 }
 
@@ -608,6 +772,24 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (sink.cached_build) {
+		// the HT was taken from the join build cache, push the filters that were generated when it was built
+		sink.temporary_memory_state->UpdateReservation(context);
+		sink.local_hash_tables.clear();
+		sink.perfect_join_executor.reset();
+		sink.external = false;
+		if (filter_pushdown && ht.Count() > 0) {
+			filter_pushdown->PushFilters(sink.join_filters, *this);
+		}
+		sink.store_in_build_cache = true;
+		sink.ScheduleFinalize(pipeline, event);
+		sink.finalized = true;
+		if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
+			return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+		}
+		return SinkFinalizeType::READY;
+	}
+
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
 	if (sink.external) {
@@ -616,17 +798,34 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 
 		const auto max_partition_ht_size =
 		    sink.max_partition_size + JoinHashTable::PointerTableSize(sink.max_partition_count);
+		auto max_ht_size = max_partition_ht_size;
+		bool repartition = false;
 		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation()) {
+			auto max_repartition_size = sink.max_partition_size;
+			auto max_repartition_count = sink.max_partition_count;
+			if (JoinHashTable::CanBuildInParts(join_type)) {
+				// Repartitioning cannot split up the rows of a single key, so we leave out the heavy hitters (skew)
+				// The partitions with these heavy hitters are built and probed in parts that fit in memory instead
+				ht.GetSplittableSize(sink.local_hash_tables, sink.temporary_memory_state->GetReservation(),
+				                     max_repartition_size, max_repartition_count);
+				max_ht_size = MinValue(max_partition_ht_size, sink.temporary_memory_state->GetReservation());
+			}
+			if (max_repartition_size + JoinHashTable::PointerTableSize(max_repartition_count) >
+			    sink.temporary_memory_state->GetReservation()) {
+				ht.SetRepartitionRadixBits(sink.temporary_memory_state->GetReservation(), max_repartition_size,
+				                           max_repartition_count);
+				repartition = true;
+			}
+		}
+		if (repartition) {
 			// We have to repartition
-			ht.SetRepartitionRadixBits(sink.temporary_memory_state->GetReservation(), sink.max_partition_size,
-			                           sink.max_partition_count);
 			auto new_event = make_shared_ptr<HashJoinRepartitionEvent>(pipeline, *this, sink, sink.local_hash_tables);
 			event.InsertEvent(std::move(new_event));
 		} else {
 			// No repartitioning! We do need some space for partitioning the probe-side, though
 			const auto probe_side_requirement =
 			    GetPartitioningSpaceRequirement(context, children[0]->types, ht.GetRadixBits(), sink.num_threads);
-			sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size + probe_side_requirement);
+			sink.temporary_memory_state->SetMinimumReservation(max_ht_size + probe_side_requirement);
 			for (auto &local_ht : sink.local_hash_tables) {
 				ht.Merge(*local_ht);
 			}
@@ -646,19 +845,21 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		sink.join_filters = filter_pushdown->GenerateFilters(*sink.global_filter_state, ht);
+		filter_pushdown->PushFilters(sink.join_filters, *this);
 	}
 
-	// check for possible perfect hash table
-	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
+	// check for possible perfect hash table (unless we can cache the HT, which allows skipping the build entirely)
+	auto use_perfect_hash =
+	    !sink.build_cache_key.IsCacheable() && sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable();
 	}
-	// In case of a large build side or duplicates, use regular hash join
+	// In case of a large build side, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		sink.store_in_build_cache =
+		    sink.build_cache_key.IsCacheable() && !sink.build_cache_key.transaction->ChangesMade();
 		sink.ScheduleFinalize(pipeline, event);
 	}
 	sink.finalized = true;
@@ -1174,7 +1375,11 @@ SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk
 		auto guard = gstate.Lock();
 		if (gstate.global_stage != HashJoinSourceStage::DONE) {
 			gstate.global_stage = HashJoinSourceStage::DONE;
-			sink.hash_table->Reset();
+			// the probe is done, return the HT to the join build cache or release its memory
+			bool stored = sink.store_in_build_cache && sink.StoreInBuildCache();
+			if (!stored) {
+				sink.hash_table->Reset();
+			}
 			sink.temporary_memory_state->SetZero();
 		}
 		return SourceResultType::FINISHED;
@@ -1251,8 +1456,18 @@ InsertionOrderPreservingMap<string> PhysicalHashJoin::ParamsToString() const {
 
 	if (perfect_join_statistics.is_build_small) {
 		// perfect hash join
-		result["Build Min"] = perfect_join_statistics.build_min.ToString();
-		result["Build Max"] = perfect_join_statistics.build_max.ToString();
+		string build_min;
+		string build_max;
+		for (idx_t key_idx = 0; key_idx < perfect_join_statistics.build_min.size(); key_idx++) {
+			if (key_idx > 0) {
+				build_min += ", ";
+				build_max += ", ";
+			}
+			build_min += perfect_join_statistics.build_min[key_idx].ToString();
+			build_max += perfect_join_statistics.build_max[key_idx].ToString();
+		}
+		result["Build Min"] = build_min;
+		result["Build Max"] = build_max;
 	}
 	SetEstimatedCardinality(result, estimated_cardinality);
 	return result;
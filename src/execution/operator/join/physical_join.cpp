@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/join/physical_join.hpp"
 
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 
@@ -28,6 +29,23 @@ bool PhysicalJoin::EmptyResultIfRHSIsEmpty() const {
 //===--------------------------------------------------------------------===//
 // Pipeline Construction
 //===--------------------------------------------------------------------===//
+//! Collects the table scans on the probe side that the join filters are pushed into
+static void GetFilterScans(const PhysicalOperator &op, const JoinFilterPushdownInfo &filter_pushdown,
+                           reference_set_t<const PhysicalOperator> &result) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		for (auto &filter : filter_pushdown.filters) {
+			if (scan.dynamic_filters && scan.dynamic_filters == filter.dynamic_filters) {
+				result.insert(op);
+				break;
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		GetFilterScans(*child, filter_pushdown, result);
+	}
+}
+
 void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipeline, PhysicalOperator &op,
                                       bool build_rhs) {
 	op.op_state.reset();
@@ -44,11 +62,22 @@ void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipe
 
 	vector<shared_ptr<Pipeline>> dependencies;
 	optional_ptr<MetaPipeline> last_child_ptr;
+	bool can_saturate_threads = false;
+	reference_set_t<const PhysicalOperator> filter_scans;
 	if (build_rhs) {
 		// on the RHS (build side), we construct a child MetaPipeline with this operator as its sink
 		auto &child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, op, MetaPipelineType::JOIN_BUILD);
 		child_meta_pipeline.Build(*op.children[1]);
-		if (op.children[1]->CanSaturateThreads(current.GetClientContext())) {
+		if (op.type == PhysicalOperatorType::HASH_JOIN) {
+			// if this join pushes filters into scans that are not part of the probe pipeline,
+			// those scans have to wait until the build side is finished and the filters have been generated
+			auto &filter_pushdown = op.Cast<PhysicalHashJoin>().filter_pushdown;
+			if (filter_pushdown && filter_pushdown->probe_side_dependencies) {
+				GetFilterScans(*op.children[0], *filter_pushdown, filter_scans);
+			}
+		}
+		can_saturate_threads = op.children[1]->CanSaturateThreads(current.GetClientContext());
+		if (can_saturate_threads || !filter_scans.empty()) {
 			// if the build side can saturate all available threads,
 			// we don't just make the LHS pipeline depend on the RHS, but recursively all LHS children too.
 			// this prevents breadth-first plan evaluation
@@ -62,7 +91,7 @@ void PhysicalJoin::BuildJoinPipelines(Pipeline &current, MetaPipeline &meta_pipe
 
 	if (last_child_ptr) {
 		// the pointer was set, set up the dependencies
-		meta_pipeline.AddRecursiveDependencies(dependencies, *last_child_ptr);
+		meta_pipeline.AddRecursiveDependencies(dependencies, *last_child_ptr, can_saturate_threads, filter_scans);
 	}
 
 	switch (op.type) {
@@ -163,7 +163,7 @@ unique_ptr<GlobalSinkState> PhysicalOperator::GetGlobalSinkState(ClientContext &
 idx_t PhysicalOperator::GetMaxThreadMemory(ClientContext &context) {
 	// Memory usage per thread should scale with max mem / num threads
 	// We take 1/4th of this, to be conservative
-	auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory(context);
 	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	return (max_memory / num_threads) / 4;
 }
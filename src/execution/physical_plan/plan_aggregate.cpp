@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -9,8 +10,13 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
@@ -149,10 +155,110 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Returns the input column that the expression references (if any)
+static optional_idx GetColumnReference(Expression &expr) {
+	if (expr.GetExpressionType() == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>().index;
+	}
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_FUNCTION) {
+		// (de)compressing values for materialization does not change which values are equal
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		auto &name = function.function.name;
+		if ((StringUtil::StartsWith(name, "__internal_compress") ||
+		     StringUtil::StartsWith(name, "__internal_decompress")) &&
+		    !function.children.empty()) {
+			return GetColumnReference(*function.children[0]);
+		}
+	}
+	return optional_idx();
+}
+
+static bool IsOrderedOnGroups(const vector<BoundOrderByNode> &orders, const unordered_set<idx_t> &group_columns) {
+	if (orders.size() < group_columns.size()) {
+		return false;
+	}
+	// the groups have to be the leading keys of the ordering (in any order), so that equal groups are adjacent
+	unordered_set<idx_t> ordered_columns;
+	for (idx_t i = 0; i < group_columns.size(); i++) {
+		auto &expr = *orders[i].expression;
+		if (expr.GetExpressionType() != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		auto column = expr.Cast<BoundReferenceExpression>().index;
+		if (group_columns.find(column) == group_columns.end()) {
+			return false;
+		}
+		ordered_columns.insert(column);
+	}
+	return ordered_columns.size() == group_columns.size();
+}
+
+static bool InputIsOrderedOnGroups(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	// the columns of the groups in the output of the child
+	vector<idx_t> columns;
+	for (auto &group : op.groups) {
+		auto column = GetColumnReference(*group);
+		if (!column.IsValid()) {
+			return false;
+		}
+		columns.push_back(column.GetIndex());
+	}
+
+	// follow the groups down to an ORDER BY, through the operators that preserve the order of their input
+	reference<LogicalOperator> child = *op.children[0];
+	while (true) {
+		switch (child.get().type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &projection = child.get().Cast<LogicalProjection>();
+			for (auto &column : columns) {
+				auto child_column = GetColumnReference(*projection.expressions[column]);
+				if (!child_column.IsValid()) {
+					return false;
+				}
+				column = child_column.GetIndex();
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			auto &projection_map = child.get().Cast<LogicalFilter>().projection_map;
+			if (!projection_map.empty()) {
+				for (auto &column : columns) {
+					column = projection_map[column];
+				}
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_LIMIT:
+			break;
+		case LogicalOperatorType::LOGICAL_ORDER_BY: {
+			auto &order = child.get().Cast<LogicalOrder>();
+			if (!order.projections.empty()) {
+				for (auto &column : columns) {
+					column = order.projections[column];
+				}
+			}
+			return IsOrderedOnGroups(order.orders, unordered_set<idx_t>(columns.begin(), columns.end()));
+		}
+		case LogicalOperatorType::LOGICAL_TOP_N:
+			return IsOrderedOnGroups(child.get().Cast<LogicalTopN>().orders,
+			                         unordered_set<idx_t>(columns.begin(), columns.end()));
+		default:
+			return false;
+		}
+		child = *child.get().children[0];
+	}
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// check whether the input arrives ordered on the groups before planning the child consumes its expressions
+	const auto ordered_on_groups = InputIsOrderedOnGroups(op);
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -178,9 +284,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// if the input is ordered on the groups, stream the groups
+		// otherwise, use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (ordered_on_groups && PhysicalStreamingAggregate::SupportsAggregates(op.expressions)) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -10,6 +10,7 @@
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parallel/event.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -139,6 +140,13 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+
+	//! Minimum number of rows that a thread must have sunk before we decide whether to skip the lookups
+	static constexpr const idx_t SKIP_LOOKUPS_MINIMUM_SINK_COUNT = 65536;
+	//! If more than this fraction of the sunk rows became a new group, pre-aggregating is not worth the lookups
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
+	//! Number of rows after which a thread that skips the lookups tries pre-aggregating again
+	static constexpr const idx_t SKIP_LOOKUPS_RECHECK_SINK_COUNT = 16 * SKIP_LOOKUPS_MINIMUM_SINK_COUNT;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -169,6 +177,8 @@ public:
 	const idx_t number_of_threads;
 	//! If any thread has called combine
 	atomic<bool> any_combined;
+	//! If any thread has stopped pre-aggregating (its data must be combined in the Finalize)
+	atomic<bool> any_skipped_lookups;
 
 	//! Uncombined partitioned data that will be put into the AggregatePartitions
 	unique_ptr<PartitionedTupleData> uncombined_data;
@@ -192,8 +202,9 @@ RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const R
     : context(context_p), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
       radix_ht(radix_ht_p), config(context, *this), finalized(false), external(false), active_threads(0),
       number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
-      any_combined(false), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
-      count_before_combining(0), max_partition_size(0) {
+      any_combined(false), any_skipped_lookups(false), finalize_done(0),
+      scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE), count_before_combining(0),
+      max_partition_size(0) {
 
 	// Compute minimum reservation
 	auto block_alloc_size = BufferManager::GetBufferManager(context).GetBlockAllocSize();
@@ -330,9 +341,16 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Whether the HT has skipped the lookups (its data may contain duplicate groups, so it can no longer be resized)
+	bool skipped_lookups;
+	//! Sink and materialized count of the HT when we last decided whether to skip the lookups
+	idx_t decision_sink_count;
+	idx_t decision_materialized_count;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : skipped_lookups(false), decision_sink_count(0), decision_materialized_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -370,7 +388,8 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 
 	// Check if we're approaching the memory limit
 	auto &temporary_memory_state = *gstate.temporary_memory_state;
-	const auto total_size = partitioned_data->SizeInBytes() + ht.Capacity() * sizeof(ht_entry_t);
+	const auto pointer_table_size = ht.SkippingLookups() ? 0 : ht.Capacity() * sizeof(ht_entry_t);
+	const auto total_size = partitioned_data->SizeInBytes() + pointer_table_size;
 	idx_t thread_limit = temporary_memory_state.GetReservation() / gstate.number_of_threads;
 	if (total_size > thread_limit) {
 		// We're over the thread memory limit
@@ -436,6 +455,33 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+void MaybeSkipLookups(RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lstate) {
+	auto &ht = *lstate.ht;
+	const auto sink_count = ht.GetSinkCount() - lstate.decision_sink_count;
+	if (ht.SkippingLookups()) {
+		if (sink_count < RadixHTConfig::SKIP_LOOKUPS_RECHECK_SINK_COUNT) {
+			return;
+		}
+		// Periodically try pre-aggregating again, the data may have become more clustered
+		ht.ResumeLookups();
+	} else {
+		if (sink_count < RadixHTConfig::SKIP_LOOKUPS_MINIMUM_SINK_COUNT) {
+			return;
+		}
+		const auto materialized_count = ht.GetMaterializedCount() - lstate.decision_materialized_count;
+		const auto materialized_ratio = static_cast<double>(materialized_count) / static_cast<double>(sink_count);
+		if (materialized_ratio >= RadixHTConfig::SKIP_LOOKUPS_THRESHOLD) {
+			// (Nearly) every row is a new group: stop looking up the groups and just materialize the rows
+			ht.SkipLookups();
+			lstate.skipped_lookups = true;
+			gstate.any_skipped_lookups = true;
+		}
+	}
+	// The next decision is based on the rows that are sunk from now on
+	lstate.decision_sink_count = ht.GetSinkCount();
+	lstate.decision_materialized_count = ht.GetMaterializedCount();
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -455,12 +501,16 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		return; // We can fit another chunk
 	}
 
-	if (gstate.number_of_threads > 2) {
+	// Check whether pre-aggregating actually reduces the data (or whether it does again, if we stopped doing so)
+	MaybeSkipLookups(gstate, lstate);
+
+	if (ht.Count() != 0 && (gstate.number_of_threads > 2 || lstate.skipped_lookups)) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
-		// This only works because we never resize the HT
+		// This only works because we never resize the HT (if we skip lookups, there is no pointer table to clear)
 		ht.ClearPointerTable();
 		ht.ResetCount();
-		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+		// We don't do this when running with 1 or 2 threads (unless we skipped lookups), it only makes sense when
+		// there's many threads
 	}
 
 	// Check if we need to repartition
@@ -475,14 +525,21 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	// TODO: combine early and often
 }
 
-void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkState &gstate_p,
-                                        LocalSinkState &lstate_p) const {
+void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkState &gstate_p, LocalSinkState &lstate_p,
+                                        optional_ptr<const PhysicalOperator> profiled_op) const {
 	auto &gstate = gstate_p.Cast<RadixHTGlobalSinkState>();
 	auto &lstate = lstate_p.Cast<RadixHTLocalSinkState>();
 	if (!lstate.ht) {
 		return;
 	}
 
+	if (profiled_op) {
+		auto &profiler = context.thread.profiler;
+		profiler.AddCounter(*profiled_op, "Sink Rows", lstate.ht->GetSinkCount());
+		profiler.AddCounter(*profiled_op, "Materialized Groups", lstate.ht->GetMaterializedCount());
+		profiler.AddCounter(*profiled_op, "Threads Skipping Pre-Aggregation", lstate.skipped_lookups ? 1 : 0);
+	}
+
 	// Set any_combined, then check one last time whether we need to repartition
 	gstate.any_combined = true;
 	MaybeRepartition(context.client, gstate, lstate);
@@ -517,7 +574,8 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 		gstate.count_before_combining = uncombined_data.Count();
 
 		// If true there is no need to combine, it was all done by a single thread in a single HT
-		const auto single_ht = !gstate.external && gstate.active_threads == 1 && gstate.number_of_threads == 1;
+		const auto single_ht = !gstate.external && !gstate.any_skipped_lookups && gstate.active_threads == 1 &&
+		                       gstate.number_of_threads == 1;
 
 		auto &uncombined_partition_data = uncombined_data.GetPartitions();
 		const auto n_partitions = uncombined_partition_data.size();
@@ -49,6 +49,9 @@ static unique_ptr<FunctionData> PragmaDatabaseSizeBind(ClientContext &context, T
 	names.emplace_back("memory_limit");
 	return_types.emplace_back(LogicalType::VARCHAR);
 
+	names.emplace_back("free_space_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -84,6 +87,9 @@ void PragmaDatabaseSizeFunction(ClientContext &context, TableFunctionInput &data
 		    row, ds.wal_size == idx_t(-1) ? Value() : Value(StringUtil::BytesToHumanReadableString(ds.wal_size)));
 		output.data[col++].SetValue(row, data.memory_usage);
 		output.data[col++].SetValue(row, data.memory_limit);
+		// the fraction of the database file that is occupied by free blocks
+		auto free_space_ratio = ds.total_blocks == 0 ? 0.0 : double(ds.free_blocks) / double(ds.total_blocks);
+		output.data[col++].SetValue(row, Value::DOUBLE(free_space_ratio));
 		row++;
 	}
 	output.SetCardinality(row);
@@ -72,6 +72,8 @@ enum class BitpackingMode : uint8_t;
 
 enum class BlockState : uint8_t;
 
+enum class BufferEvictionPolicy : uint8_t;
+
 enum class CAPIResultSetType : uint8_t;
 
 enum class CSVState : uint8_t;
@@ -419,6 +421,9 @@ const char* EnumUtil::ToChars<BitpackingMode>(BitpackingMode value);
 template<>
 const char* EnumUtil::ToChars<BlockState>(BlockState value);
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value);
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value);
 
@@ -909,6 +914,9 @@ BitpackingMode EnumUtil::FromString<BitpackingMode>(const char *value);
 template<>
 BlockState EnumUtil::FromString<BlockState>(const char *value);
 
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value);
+
 template<>
 CAPIResultSetType EnumUtil::FromString<CAPIResultSetType>(const char *value);
 
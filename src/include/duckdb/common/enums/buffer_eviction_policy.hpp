@@ -0,0 +1,20 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferEvictionPolicy : uint8_t {
+	LRU = 0,      //! Evict the least recently unpinned blocks first
+	TWO_QUEUE = 1 //! Keep blocks that are pinned again after being unpinned in a protected queue, evicted last
+};
+
+} // namespace duckdb
@@ -69,9 +69,15 @@ public:
 
 protected:
 	//! The pointer to the internal buffer that will be read or written, including the buffer header
+	//! This is aligned to the sector size (except for tiny buffers), which is necessary to support DIRECT_IO
 	data_ptr_t internal_buffer;
 	//! The aligned size as passed to the constructor. This is the size that is read or written to disk.
 	uint64_t internal_size;
+	//! The pointer to the allocated memory, internal_buffer points into this
+	data_ptr_t malloced_buffer;
+	//! The size of the allocated memory, this is larger than internal_size if the allocator did not return memory
+	//! that is aligned to the sector size
+	uint64_t malloced_size;
 
 	void ReallocBuffer(size_t malloc_size);
 	void Init();
@@ -51,6 +51,17 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A positional read of nr_bytes at the given location in a file, that is performed as part of a batch of reads
+struct FileReadRequest {
+	FileReadRequest(void *buffer, idx_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	void *buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -61,6 +72,7 @@ public:
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void ReadBatch(vector<FileReadRequest> &requests);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
 	DUCKDB_API idx_t SeekPosition();
@@ -118,6 +130,9 @@ public:
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Perform a batch of (non-overlapping) positional reads. Fails if any of the reads could not be completed. File
+	//! systems can override this to submit all reads at once, the default implementation performs them one-by-one.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests);
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
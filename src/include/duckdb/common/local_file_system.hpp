@@ -24,6 +24,9 @@ public:
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	//! Perform a batch of (non-overlapping) positional reads. On Linux, the reads are submitted at once using io_uring
+	//! if the kernel supports it. Otherwise, they are performed one-by-one.
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override;
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
@@ -42,6 +42,9 @@ public:
 	inline bool operator==(const optional_idx &rhs) const {
 		return index == rhs.index;
 	}
+	inline bool operator!=(const optional_idx &rhs) const {
+		return index != rhs.index;
+	}
 
 private:
 	idx_t index;
@@ -0,0 +1,16 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/prefetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+//! Hints the CPU to load the cache line containing the address, so a later (random) access does not stall
+#if __GNUC__
+#define DUCKDB_PREFETCH(address) (__builtin_prefetch(address))
+#else
+#define DUCKDB_PREFETCH(address) ((void)(address))
+#endif
@@ -94,6 +94,8 @@ private:
 	void InitializeChunkStateInternal(TupleDataPinState &pin_state, TupleDataChunkState &chunk_state, idx_t offset,
 	                                  bool recompute, bool init_heap_pointers, bool init_heap_sizes,
 	                                  unsafe_vector<reference<TupleDataChunkPart>> &parts);
+	//! Prefetches the blocks of the chunk that are not pinned yet, so that spilled blocks are read in a single batch
+	void PrefetchChunkBlocks(TupleDataPinState &pin_state, const TupleDataChunk &chunk);
 	//! Internal function for ReleaseOrStoreHandles
 	static void ReleaseOrStoreHandlesInternal(TupleDataSegment &segment,
 	                                          unsafe_vector<BufferHandle> &pinned_row_handles,
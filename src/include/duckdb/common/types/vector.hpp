@@ -144,6 +144,8 @@ public:
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count);
 	//! Slice the vector, keeping the result around in a cache or potentially using the cache instead of slicing
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count, SelCache &cache);
+	//! Turns this vector into a dictionary vector over the given dictionary of the given size
+	DUCKDB_API void Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count);
 
 	//! Creates the data of this vector with the specified type. Any data that
 	//! is currently in the vector is destroyed.
@@ -320,6 +322,23 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The number of entries in the dictionary, if it is known
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
+	//! The identifier of the dictionary, which is only set if the dictionary is shared across vectors (e.g., by all
+	//! vectors that are scanned from the same dictionary compressed segment)
+	static inline const optional_idx &DictionaryId(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionaryId();
+	}
+	static inline void SetDictionaryId(Vector &vector, idx_t new_id) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		vector.buffer->Cast<DictionaryBuffer>().SetDictionaryId(new_id);
+	}
+	//! Creates a new unique dictionary identifier
+	DUCKDB_API static idx_t CreateDictionaryId();
 };
 
 struct FlatVector {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/common/types/string_type.hpp"
@@ -159,9 +160,25 @@ public:
 	void SetSelVector(const SelectionVector &vector) {
 		this->sel_vector.Initialize(vector);
 	}
+	//! The number of entries in the dictionary (if known)
+	const optional_idx &GetDictionarySize() const {
+		return dictionary_size;
+	}
+	void SetDictionarySize(idx_t size) {
+		dictionary_size = size;
+	}
+	//! An identifier of the dictionary (if any) - vectors with the same identifier share the same dictionary
+	const optional_idx &GetDictionaryId() const {
+		return dictionary_id;
+	}
+	void SetDictionaryId(const optional_idx &id) {
+		dictionary_id = id;
+	}
 
 private:
 	SelectionVector sel_vector;
+	optional_idx dictionary_size;
+	optional_idx dictionary_id;
 };
 
 class VectorStringBuffer : public VectorBuffer {
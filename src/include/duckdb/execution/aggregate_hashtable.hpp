@@ -90,6 +90,19 @@ public:
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
 
+	//! Stop looking up groups in the pointer table, and materialize every added row as a new group instead. This is
+	//! used when (nearly) every row has a unique group, so that the groups are only combined during the Finalize.
+	//! The pointer table is freed until the lookups are resumed
+	void SkipLookups();
+	//! Start looking up groups again, with an empty pointer table
+	void ResumeLookups();
+	//! Whether we are skipping the lookups
+	bool SkippingLookups() const;
+	//! Number of rows that were added to the HT
+	idx_t GetSinkCount() const;
+	//! Number of groups that were materialized for the rows that were added to the HT
+	idx_t GetMaterializedCount() const;
+
 	//! Executes the filter(if any) and update the aggregates
 	void Combine(GroupedAggregateHashTable &other);
 	void Combine(TupleDataCollection &other_data, optional_ptr<atomic<double>> progress = nullptr);
@@ -101,6 +114,24 @@ private:
 	//! Efficiently matches groups
 	RowMatcher row_matcher;
 
+	//! Caches the group addresses of the entries of the dictionary vector that was last added
+	struct AggregateDictionaryState {
+		AggregateDictionaryState();
+
+		//! The id of the cached dictionary (if any)
+		optional_idx dictionary_id;
+		//! The group addresses of the dictionary entries, valid only where found_entry is set
+		unsafe_unique_array<data_ptr_t> dictionary_addresses;
+		unsafe_unique_array<bool> found_entry;
+		//! The number of dictionary entries that fit in the above arrays
+		idx_t capacity;
+		//! The dictionary entries that were not seen before in the current chunk
+		SelectionVector unique_entries;
+		DataChunk unique_values;
+		Vector hashes;
+		Vector new_addresses;
+	};
+
 	//! Append state
 	struct AggregateHTAppendState {
 		AggregateHTAppendState();
@@ -116,6 +147,7 @@ private:
 		Vector addresses;
 		unsafe_unique_array<UnifiedVectorFormat> group_data;
 		DataChunk group_chunk;
+		AggregateDictionaryState dict_state;
 	} state;
 
 	//! The number of radix bits to partition by
@@ -128,6 +160,11 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether every added row is materialized as a new group without looking it up in the pointer table
+	bool skip_lookups;
+	//! The number of rows that were added, and the number of groups that were materialized for them
+	idx_t sink_count;
+	idx_t materialized_count;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -155,6 +192,13 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! Adds a chunk grouped by a single dictionary vector by looking up only the dictionary entries that were not
+	//! seen before. Returns an invalid index if the chunk cannot be added this way
+	optional_idx TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
+	//! Updates the aggregates of the groups in state.addresses with the payload
+	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
+	//! Invalidates the cached dictionary group addresses
+	void ResetDictionaryState();
 
 	//! Verify the pointer table of the HT
 	void Verify();
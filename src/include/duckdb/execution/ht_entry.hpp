@@ -25,6 +25,9 @@ public:
 	static constexpr const hash_t SALT_MASK = 0xFFFF000000000000;
 	//! Lower 48 bits are the pointer
 	static constexpr const hash_t POINTER_MASK = 0x0000FFFFFFFFFFFF;
+	//! Hash tables with a larger capacity (more than 2 MiB of entries) are unlikely to fit in the CPU caches, so we
+	//! prefetch their entries, and the rows these point to, before accessing them
+	static constexpr const idx_t PREFETCH_THRESHOLD = 262144;
 
 	explicit inline ht_entry_t(hash_t value_p) noexcept : value(value_p) {
 	}
@@ -18,9 +18,11 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/ht_entry.hpp"
+#include "duckdb/execution/reservoir_sample.hpp"
 
 namespace duckdb {
 
+class BloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -173,6 +175,12 @@ public:
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
 	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel);
+	//! Undoes Finalize: frees the pointer table and unpins the data, so that the data can be spilled to disk
+	//! The HT has to be finalized again before it can be probed
+	void Unfinalize();
+	//! Insert the hashes of the rows into the Bloom filter. Finalize overwrites the hashes, so this must be called
+	//! before the HT is finalized. Only HTs with a single equality condition store the hashes of that key.
+	void InsertHashesIntoBloomFilter(BloomFilter &bloom_filter);
 	//! Probe the HT with the given input chunk, resulting in the given result
 	void Probe(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state, ProbeState &probe_state,
 	           optional_ptr<Vector> precomputed_hashes = nullptr);
@@ -202,8 +210,6 @@ public:
 
 	//! BufferManager
 	BufferManager &buffer_manager;
-	//! The join conditions
-	const vector<JoinCondition> &conditions;
 	//! The types of the keys used in equality comparison
 	vector<LogicalType> equality_types;
 	//! The types of the keys
@@ -211,7 +217,7 @@ public:
 	//! The types of all conditions
 	vector<LogicalType> build_types;
 	//! Positions of the columns that need to output
-	const vector<idx_t> &output_columns;
+	const vector<idx_t> output_columns;
 	//! The comparison predicates that only contain equality predicates
 	vector<ExpressionType> equality_predicates;
 	//! The comparison predicates that contain non-equality predicates
@@ -310,6 +316,12 @@ private:
 	vector<bool> null_values_are_equal;
 	//! An empty tuple that's a "dead end", can be used to stop chains early
 	unsafe_unique_array<data_t> dead_end;
+	//! Whether to sample the hashes of the build-side keys
+	bool sample_hashes = false;
+	//! Sample of the hashes of the build-side keys, used to detect heavy hitters (skew) for the external join
+	unique_ptr<ReservoirSample> hash_sample;
+	//! The number of chunks that were added to the HT, only every few of these are sampled
+	idx_t build_chunk_count = 0;
 
 	//! Copying not allowed
 	JoinHashTable(const JoinHashTable &) = delete;
@@ -319,6 +331,12 @@ public:
 	// External Join
 	//===--------------------------------------------------------------------===//
 	static constexpr const idx_t INITIAL_RADIX_BITS = 4;
+	//! The number of build-side key hashes that each thread-local HT samples
+	static constexpr const idx_t HASH_SAMPLE_SIZE = 1024;
+	//! Only the hashes of every this many build-side chunks are sampled, so sampling stays cheap
+	static constexpr const idx_t HASH_SAMPLE_CHUNK_INTERVAL = 8;
+	//! The minimum number of times a hash has to occur in the samples before we consider it a heavy hitter
+	static constexpr const idx_t HEAVY_HITTER_MIN_SAMPLE_COUNT = 8;
 
 	struct ProbeSpillLocalAppendState {
 		ProbeSpillLocalAppendState() {
@@ -379,6 +397,19 @@ public:
 		return partition_end;
 	}
 
+	//! Whether the partition of the current probe round is built in parts, and has parts remaining after this round
+	bool HasRemainingParts() const {
+		return !remaining_parts.empty();
+	}
+
+	//! Whether a partition that does not fit in memory can be built and probed in parts. This is only the case if
+	//! the result for a probe-side row does not depend on the build-side rows in the other parts
+	static bool CanBuildInParts(JoinType join_type);
+	//! Enable sampling the hashes of the build-side keys, so we can detect heavy hitters (skew) if we go external
+	void EnableHashSample() {
+		sample_hashes = true;
+	}
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -394,6 +425,11 @@ public:
 	                   idx_t &max_partition_count) const;
 	idx_t GetTotalSize(const vector<idx_t> &partition_sizes, const vector<idx_t> &partition_counts,
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
+	//! Get the size of the largest partition if the rows of heavy hitter keys that do not fit in max_ht_size by
+	//! themselves are left out. Repartitioning cannot split up the rows of a single key, so this is the size that
+	//! repartitioning can reduce. The partitions with these heavy hitters are built and probed in parts instead
+	void GetSplittableSize(const vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
+	                       idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize() const;
 	//! Sets number of radix bits according to the max ht size
@@ -411,6 +447,10 @@ public:
 	                   ProbeState &probe_state, DataChunk &payload, ProbeSpill &probe_spill,
 	                   ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk);
 
+private:
+	//! Split up a partition that does not fit in memory into parts of at most max_ht_size
+	void SplitPartition(TupleDataCollection &partition, const idx_t max_ht_size);
+
 private:
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
@@ -418,6 +458,8 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+	//! The remaining parts of the partition of the current probe round, if it does not fit in memory
+	vector<unique_ptr<TupleDataCollection>> remaining_parts;
 };
 
 } // namespace duckdb
@@ -46,7 +46,7 @@ public:
 	                          OperatorSinkFinalizeInput &input) const override;
 
 	bool IsSink() const override {
-		return info->has_table;
+		return info->has_table && !info->options.full;
 	}
 
 	bool ParallelSink() const override {
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_build_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class DataTableInfo;
+class DuckTransaction;
+class JoinHashTable;
+class PhysicalHashJoin;
+
+//! JoinBuildCacheKey identifies the build side of a hash join, and the version of the data it reads
+struct JoinBuildCacheKey {
+	//! The fingerprint of the build side (empty if the build side cannot be cached)
+	string fingerprint;
+	//! The commit timestamp of the last write to the database that the build side reads from
+	transaction_t commit_version = 0;
+	//! The storage of the table that the build side scans
+	shared_ptr<DataTableInfo> table_info;
+	//! The transaction that the build side is read in
+	optional_ptr<DuckTransaction> transaction;
+
+	bool IsCacheable() const {
+		return !fingerprint.empty();
+	}
+};
+
+//! JoinBuildCacheEntry holds the finalized hash table of a hash join build side while it is in the join build cache
+struct JoinBuildCacheEntry {
+	JoinBuildCacheEntry();
+	~JoinBuildCacheEntry();
+
+	//! The hash table (unpinned and without a pointer table, it has to be finalized again before it can be probed)
+	shared_ptr<JoinHashTable> hash_table;
+	//! The filters that were pushed into the probe side when the hash table was built
+	join_filter_map_t filters;
+	//! The commit timestamp of the last write to the database when the hash table was built
+	transaction_t commit_version;
+	//! The storage of the table that the hash table was built from
+	weak_ptr<DataTableInfo> table_info;
+	//! The size of the data of the hash table
+	idx_t size;
+	//! The position of the entry in the LRU list of the cache
+	list<string>::iterator lru_position;
+};
+
+//! JoinBuildCache caches the finalized hash tables of hash join build sides across queries, so that queries that
+//! repeatedly join against the same (unchanged) table do not have to rebuild the hash table every time.
+//! The data of the cached hash tables is unpinned, so it is charged to the buffer pool and can be spilled to disk.
+//! A query takes the hash table out of the cache and returns it once it is done probing, so that every cached hash
+//! table is used by a single query at a time. The least recently used entries are evicted once the total size of the
+//! cached hash tables exceeds the join_build_cache_size setting.
+class JoinBuildCache : public ObjectCacheEntry {
+public:
+	~JoinBuildCache() override;
+
+	//! Computes the cache key for the build side of the hash join. Only build sides that consist of a scan of a
+	//! DuckDB table with (deterministic) filters and projections are cached
+	static JoinBuildCacheKey GetKey(ClientContext &context, const PhysicalHashJoin &op);
+	//! Takes the cached hash table for the key out of the cache (if any). Entries are only returned if they have the
+	//! filters for all join conditions in filter_pushdown
+	static unique_ptr<JoinBuildCacheEntry> Take(ClientContext &context, const JoinBuildCacheKey &key,
+	                                            optional_ptr<const JoinFilterPushdownInfo> filter_pushdown);
+	//! Unpins the finalized hash table and stores it for the key, together with the filters that were generated.
+	//! Returns false if the hash table was not stored
+	static bool Store(ClientContext &context, const JoinBuildCacheKey &key, shared_ptr<JoinHashTable> hash_table,
+	                  join_filter_map_t filters);
+
+	static string ObjectType() {
+		return "join_build_cache";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	static JoinBuildCache &Get(ClientContext &context);
+	//! Removes the entry from the cache (lock must be held)
+	unique_ptr<JoinBuildCacheEntry> RemoveEntry(const string &fingerprint);
+
+private:
+	mutex lock;
+	//! The cached hash tables
+	unordered_map<string, unique_ptr<JoinBuildCacheEntry>> entries;
+	//! The fingerprints of the cached hash tables, from least to most recently used
+	list<string> lru;
+	//! The total size of the cached hash tables
+	idx_t total_size = 0;
+};
+
+} // namespace duckdb
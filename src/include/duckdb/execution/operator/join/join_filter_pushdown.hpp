@@ -8,21 +8,29 @@
 
 #pragma once
 
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class ColumnDataCollection;
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
+//! The filters that are generated from the build side of a join for the probe side, per join condition
+using join_filter_map_t = unordered_map<idx_t, vector<unique_ptr<TableFilter>>>;
+
 struct JoinFilterPushdownColumn {
 	//! The join condition from which this filter pushdown is generated
 	idx_t join_condition;
 	//! The probe column index to which this filter should be applied
 	ColumnBinding probe_column_index;
+	//! The dynamic table filter set of the scan where to push this filter into
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 };
 
 struct JoinFilterGlobalState {
@@ -30,6 +38,15 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+
+	//! Lock for the IN filter keys
+	mutex lock;
+	//! The maximum number of build-side rows for which we generate Bloom filters
+	idx_t bloom_filter_threshold;
+	//! The maximum number of build-side rows for which we generate IN filters (0 if we are not generating them)
+	idx_t in_filter_threshold;
+	//! The build-side keys, used to generate IN filters
+	unique_ptr<ColumnDataCollection> in_filter_keys;
 };
 
 struct JoinFilterLocalState {
@@ -37,15 +54,21 @@ struct JoinFilterLocalState {
 
 	//! Local Min/Max aggregates for filter pushdown
 	unique_ptr<LocalUngroupedAggregateState> local_aggregate_state;
+
+	//! The maximum number of build-side rows for which we generate IN filters (0 if we are not generating them)
+	idx_t in_filter_threshold;
+	//! The build-side keys, used to generate IN filters
+	unique_ptr<ColumnDataCollection> in_filter_keys;
 };
 
 struct JoinFilterPushdownInfo {
-	//! The dynamic table filter set where to push filters into
-	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
+	//! Whether any of the filters is pushed into a scan outside of the probe pipeline (e.g., the build side of another
+	//! join). In that case, the pipelines of the probe side have to wait for the build side of this join to finish.
+	bool probe_side_dependencies = false;
 
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
@@ -53,7 +76,12 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	//! Returns the memory that is required for the Bloom filters of a build side with "build_count" rows
+	idx_t GetBloomFilterSize(JoinFilterGlobalState &gstate, const JoinHashTable &ht, idx_t build_count) const;
+	//! Generates the filters for the probe side from the build side (the Bloom filters from the hashes in the HT)
+	join_filter_map_t GenerateFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht) const;
+	//! Pushes the generated filters into the scans of the probe side
+	void PushFilters(const join_filter_map_t &join_filters, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
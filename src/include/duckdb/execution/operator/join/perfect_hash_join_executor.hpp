@@ -20,14 +20,18 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The min/max of each of the join keys
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The number of slots of the perfect hash table minus one (the product of the key ranges minus one)
 	idx_t build_range = 0;
+	//! The multiplier of each of the join keys when packing the keys into a slot
+	vector<idx_t> key_multipliers;
 	idx_t estimated_cardinality = 0;
 };
 
@@ -38,27 +42,28 @@ class PerfectHashJoinExecutor {
 public:
 	explicit PerfectHashJoinExecutor(const PhysicalHashJoin &join, JoinHashTable &ht, PerfectHashJoinStats pjoin_stats);
 
+	//! The max number of build-side rows for which we create a perfect hash table if keys occur more than once
+	static constexpr const idx_t MAX_DUPLICATE_BUILD_SIZE = 1000000;
+
 public:
 	bool CanDoPerfectHashJoin();
 
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	//! Computes the slot of each key by packing the key columns using their build-side ranges. Sets "in_range" to
+	//! false for keys that are NULL or outside of the build-side range, as these cannot have a match
+	void ComputeSlots(DataChunk &keys, idx_t count, idx_t slots[], bool in_range[]) const;
+	void ComputeSlotsSwitch(Vector &source, idx_t key_idx, idx_t count, idx_t slots[], bool in_range[]) const;
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	void TemplatedComputeSlots(Vector &source, idx_t key_idx, idx_t count, idx_t slots[], bool in_range[]) const;
 
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	bool FullScanHashTable();
+	//! Probe if keys occur more than once in the build side, this can produce more than one vector of output
+	OperatorResultType ProbeDuplicates(DataChunk &input, DataChunk &result, OperatorState &state);
 
 private:
 	const PhysicalHashJoin &join;
@@ -71,6 +76,11 @@ private:
 	unsafe_unique_array<bool> bitmap_build_idx;
 	//! Stores the number of unique keys in the build side
 	idx_t unique_keys = 0;
+	//! Whether any of the keys occurs more than once in the build side
+	bool has_duplicates = false;
+	//! If keys occur more than once, the perfect hash table stores the build-side rows grouped by slot, and the rows
+	//! of a slot are at [build_offsets[slot], build_offsets[slot + 1])
+	unsafe_unique_array<idx_t> build_offsets;
 };
 
 } // namespace duckdb
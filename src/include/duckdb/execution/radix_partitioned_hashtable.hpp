@@ -39,7 +39,10 @@ public:
 
 	void Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input, DataChunk &aggregate_input_chunk,
 	          const unsafe_vector<idx_t> &filter) const;
-	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const;
+	//! Combines the thread-local HT into the global state. If an operator is given, the pre-aggregation statistics
+	//! of the thread are added to its profiling information
+	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate,
+	             optional_ptr<const PhysicalOperator> profiled_op = nullptr) const;
 	void Finalize(ClientContext &context, GlobalSinkState &gstate) const;
 
 public:
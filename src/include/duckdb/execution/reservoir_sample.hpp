@@ -76,6 +76,11 @@ public:
 	virtual unique_ptr<DataChunk> GetChunk() = 0;
 	BaseReservoirSampling old_base_reservoir_sample;
 
+	//! The number of tuples that were added to the sample so far (including the ones that were not sampled)
+	idx_t GetTuplesSeen() const {
+		return old_base_reservoir_sample.num_entries_seen_total;
+	}
+
 	virtual void Serialize(Serializer &serializer) const;
 	static unique_ptr<BlockingSample> Deserialize(Deserializer &deserializer);
 
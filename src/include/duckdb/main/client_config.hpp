@@ -101,9 +101,22 @@ struct ClientConfig {
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
 	idx_t merge_join_threshold = 1000;
+	//! The maximum number of build-side rows of a hash join for which we push a Bloom filter into the probe-side scan
+	//! (0 to disable). This is disabled by default, as the filter costs time for scans where it prunes few rows
+	idx_t join_bloom_filter_threshold = 0;
+	//! The maximum number of build-side rows of a hash join for which we push an IN filter into the probe-side scan
+	//! (0 to disable). This is disabled by default, as the filter costs time for scans where it prunes few rows
+	idx_t join_in_filter_threshold = 0;
+	//! Whether or not finalized hash join build sides are cached and reused by subsequent queries
+	bool enable_join_build_cache = false;
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! The number of row groups ahead of the scanning threads whose blocks are loaded in the background during table
+	//! scans. Default: 0 (no read-ahead).
+	idx_t scan_prefetch_depth = 0;
+	//! The maximum amount of memory that operators of a single query of this connection can reserve. Default: none.
+	idx_t query_memory_limit = NumericLimits<idx_t>::Maximum();
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
@@ -14,6 +14,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -124,6 +125,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints are performed by a background thread instead of by the committing transaction
+	bool background_checkpoint = false;
+	//! Whether concurrent commits are made durable with a single, shared fsync of the WAL
+	bool wal_group_commit = false;
+	//! The time (in microseconds) the leader of a group commit waits for other commits before syncing the WAL
+	idx_t wal_group_commit_max_wait = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -157,11 +164,15 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks that are written to the temporary directory
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! The policy that the buffer pool uses to decide which blocks to evict first
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
@@ -176,6 +187,10 @@ struct DBConfigOptions {
 	bool object_cache_enable = false;
 	//! Whether or not the global http metadata cache is used
 	bool http_metadata_cache_enable = false;
+	//! The maximum total size of the hash tables in the join build cache (in bytes)
+	idx_t join_build_cache_size = 268435456;
+	//! Whether or not checkpoints store min/max statistics for every vector of a column
+	bool enable_vector_zonemaps = false;
 	//! HTTP Proxy config as 'hostname:port'
 	string http_proxy;
 	//! HTTP Proxy username for basic auth
@@ -272,6 +287,9 @@ struct DBConfigOptions {
 	bool debug_skip_checkpoint_on_commit = false;
 	//! The maximum amount of vacuum tasks to schedule during a checkpoint
 	idx_t max_vacuum_tasks = 100;
+	//! The fraction of deleted rows at which a row group that cannot be merged is rewritten during a checkpoint
+	//! (0 to disable). Rewriting costs checkpoint time, so this is disabled by default
+	double vacuum_rewrite_threshold = 0;
 
 	bool operator==(const DBConfigOptions &other) const;
 };
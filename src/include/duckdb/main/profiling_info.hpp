@@ -33,6 +33,8 @@ public:
 	// Additional metrics.
 	// FIXME: move to metrics.
 	InsertionOrderPreservingMap<string> extra_info;
+	// Operator-specific counters, summed up over all threads. These are rendered with the extra info.
+	InsertionOrderPreservingMap<idx_t> counters;
 
 public:
 	ProfilingInfo() = default;
@@ -58,6 +60,8 @@ public:
 
 public:
 	string GetMetricAsString(MetricsType setting) const;
+	//! Returns the extra info, including the rendered operator-specific counters
+	InsertionOrderPreservingMap<string> GetExtraInfo() const;
 	void WriteMetricsToJSON(duckdb_yyjson::yyjson_mut_doc *doc, duckdb_yyjson::yyjson_mut_val *destination);
 
 public:
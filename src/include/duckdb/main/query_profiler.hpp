@@ -55,6 +55,18 @@ struct OperatorInformation {
 	void AddResultSetSize(idx_t n_result_set_size) {
 		result_set_size += n_result_set_size;
 	}
+
+	//! Operator-specific counters, these are shown with the extra info of the operator
+	InsertionOrderPreservingMap<idx_t> counters;
+
+	void AddCounter(const string &counter_name, idx_t value) {
+		auto entry = counters.find(counter_name);
+		if (entry == counters.end()) {
+			counters.insert(counter_name, value);
+		} else {
+			entry->second += value;
+		}
+	}
 };
 
 //! The OperatorProfiler measures timings of individual operators
@@ -71,6 +83,8 @@ public:
 	//! Adds the timings in the OperatorProfiler (tree) to the QueryProfiler (tree).
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op);
 	DUCKDB_API OperatorInformation &GetOperatorInfo(const PhysicalOperator &phys_op);
+	//! Adds to an operator-specific counter (if profiling is enabled)
+	DUCKDB_API void AddCounter(const PhysicalOperator &phys_op, const string &counter_name, idx_t value);
 
 	~OperatorProfiler() {
 	}
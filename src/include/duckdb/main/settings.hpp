@@ -71,6 +71,27 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Perform automatic checkpoints in a background thread instead of during the commit that triggers them. Under a "
+	    "sustained write load the background checkpoint eventually blocks new write transactions until it is done";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to decide which blocks to evict from the buffer pool first (LRU or 2Q)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CatalogErrorMaxSchema {
 	static constexpr const char *Name = "catalog_error_max_schemas";
 	static constexpr const char *Description =
@@ -366,6 +387,17 @@ struct EnableHTTPMetadataCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableJoinBuildCacheSetting {
+	static constexpr const char *Name = "enable_join_build_cache";
+	static constexpr const char *Description =
+	    "Whether or not the hash tables of hash join build sides are kept in memory and reused by subsequent queries "
+	    "that read the same, unchanged data";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableProfilingSetting {
 	static constexpr const char *Name = "enable_profiling";
 	static constexpr const char *Description =
@@ -405,6 +437,16 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableVectorZonemapsSetting {
+	static constexpr const char *Name = "enable_vector_zonemaps";
+	static constexpr const char *Description =
+	    "Whether or not checkpoints store min/max statistics for every vector, allowing scans to skip vectors";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ErrorsAsJsonSetting {
 	static constexpr const char *Name = "errors_as_json";
 	static constexpr const char *Description = "Output error messages as structured JSON instead of as a raw string";
@@ -563,6 +605,38 @@ struct ImmediateTransactionModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct JoinBloomFilterThreshold {
+	static constexpr const char *Name = "join_bloom_filter_threshold";
+	static constexpr const char *Description =
+	    "The maximum number of build-side rows of a hash join for which a Bloom filter is pushed into the probe-side "
+	    "scan (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct JoinBuildCacheSize {
+	static constexpr const char *Name = "join_build_cache_size";
+	static constexpr const char *Description =
+	    "The maximum total size of the hash tables that are kept in the join build cache (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct JoinInFilterThreshold {
+	static constexpr const char *Name = "join_in_filter_threshold";
+	static constexpr const char *Description =
+	    "The maximum number of build-side rows of a hash join for which an IN filter is pushed into the probe-side "
+	    "scan (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumExpressionDepthSetting {
 	static constexpr const char *Name = "max_expression_depth";
 	static constexpr const char *Description =
@@ -583,6 +657,26 @@ struct MaximumMemorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ScanPrefetchDepthSetting {
+	static constexpr const char *Name = "scan_prefetch_depth";
+	static constexpr const char *Description =
+	    "The number of row groups ahead of the scan whose blocks are read in the background during table scans";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory that a single query of this connection can use before operators spill to disk (e.g. 1GB)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StreamingBufferSize {
 	static constexpr const char *Name = "streaming_buffer_size";
 	static constexpr const char *Description =
@@ -612,6 +706,17 @@ struct MaximumVacuumTasks {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct VacuumRewriteThreshold {
+	static constexpr const char *Name = "vacuum_rewrite_threshold";
+	static constexpr const char *Description =
+	    "The fraction of deleted rows at which a row group is rewritten during a checkpoint to reclaim the space (0 to "
+	    "disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MergeJoinThreshold {
 	static constexpr const char *Name = "merge_join_threshold";
 	static constexpr const char *Description = "The number of rows we need on either table to choose a merge join";
@@ -868,6 +973,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress (with LZ4) the blocks that are written to the temporary directory";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -886,6 +1001,36 @@ struct UsernameSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct UseDirectIOSetting {
+	static constexpr const char *Name = "use_direct_io";
+	static constexpr const char *Description = "Whether to bypass the OS page cache with direct IO for database files "
+	                                           "that are attached afterwards, and for temporary files";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Whether concurrently committing transactions share a single fsync of the write-ahead log";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitMaxWaitSetting {
+	static constexpr const char *Name = "wal_group_commit_max_wait";
+	static constexpr const char *Description =
+	    "The time in microseconds that a group commit waits for other transactions to join before syncing the WAL";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllocatorFlushThreshold {
 	static constexpr const char *Name = "allocator_flush_threshold";
 	static constexpr const char *Description =
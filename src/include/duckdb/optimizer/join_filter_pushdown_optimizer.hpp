@@ -12,6 +12,7 @@
 #include "duckdb/planner/column_binding_map.hpp"
 
 namespace duckdb {
+class LogicalGet;
 class Optimizer;
 
 //! The JoinFilterPushdownOptimizer links comparison joins to data sources to enable dynamic execution-time filter
@@ -24,6 +25,9 @@ public:
 
 private:
 	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Follows the binding down the probe side to the LogicalGet that produces it (if possible)
+	//! Sets "crosses_pipeline" if the scan is not part of the probe pipeline of the join
+	static optional_ptr<LogicalGet> RouteFilter(LogicalOperator &op, ColumnBinding &binding, bool &crosses_pipeline);
 
 private:
 	Optimizer &optimizer;
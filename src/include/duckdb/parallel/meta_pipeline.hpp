@@ -54,6 +54,8 @@ public:
 	MetaPipeline &GetLastChild();
 	//! Get the dependencies of the Pipelines of this MetaPipeline
 	const reference_map_t<Pipeline, vector<reference<Pipeline>>> &GetDependencies() const;
+	//! Get the dependencies of the Pipelines of this MetaPipeline on the pipelines whose sink has to be finalized first
+	const reference_map_t<Pipeline, vector<reference<Pipeline>>> &GetFinishDependencies() const;
 	//! Whether the sink of this pipeline is a join build
 	MetaPipelineType Type() const;
 	//! Whether this MetaPipeline has a recursive CTE
@@ -66,7 +68,13 @@ public:
 	//! where 'including' determines whether 'start' is added to the dependencies
 	vector<shared_ptr<Pipeline>> AddDependenciesFrom(Pipeline &dependant, const Pipeline &start, bool including);
 	//! Recursively makes all children of this MetaPipeline depend on the given Pipeline
-	void AddRecursiveDependencies(const vector<shared_ptr<Pipeline>> &new_dependencies, const MetaPipeline &last_child);
+	//! Dependencies are only added between pipelines that can keep all threads busy (if "add_regular_dependencies" is
+	//! set), or to the pipelines with one of "forced_sources" as source (e.g., scans that wait for join filters).
+	//! The latter only start once the sink of the given Pipeline has been finalized
+	void AddRecursiveDependencies(
+	    const vector<shared_ptr<Pipeline>> &new_dependencies, const MetaPipeline &last_child,
+	    bool add_regular_dependencies = true,
+	    const reference_set_t<const PhysicalOperator> &forced_sources = reference_set_t<const PhysicalOperator>());
 	//! Make sure that the given pipeline has its own PipelineFinishEvent (e.g., for IEJoin - double Finalize)
 	void AddFinishEvent(Pipeline &pipeline);
 	//! Whether the pipeline needs its own PipelineFinishEvent
@@ -108,6 +116,8 @@ private:
 	vector<shared_ptr<Pipeline>> pipelines;
 	//! Dependencies of Pipelines of this MetaPipeline
 	reference_map_t<Pipeline, vector<reference<Pipeline>>> pipeline_dependencies;
+	//! Dependencies of Pipelines of this MetaPipeline that wait until the sink of the dependency has been finalized
+	reference_map_t<Pipeline, vector<reference<Pipeline>>> pipeline_finish_dependencies;
 	//! Other MetaPipelines that this MetaPipeline depends on
 	vector<shared_ptr<MetaPipeline>> children;
 	//! Next batch index
@@ -20,11 +20,13 @@ class Serializer;
 class Deserializer;
 
 struct VacuumOptions {
-	VacuumOptions() : vacuum(false), analyze(false) {
+	VacuumOptions() : vacuum(false), analyze(false), full(false) {
 	}
 
 	bool vacuum;
 	bool analyze;
+	//! VACUUM FULL: relocate data towards the start of the database file and truncate the file
+	bool full;
 
 	void Serialize(Serializer &serializer) const;
 	static VacuumOptions Deserialize(Deserializer &deserializer);
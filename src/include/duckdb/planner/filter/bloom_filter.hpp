@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class SelectionVector;
+class Vector;
+struct UnifiedVectorFormat;
+
+//! The BloomFilter is a blocked Bloom filter over the hashes of a set of keys (e.g., the build side of a hash join)
+//! It can have false positives, but never has false negatives: rows that do not pass the filter are not in the set
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The number of filter bits reserved per key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+
+public:
+	//! Creates an empty Bloom filter that is sized for "key_count" keys
+	explicit BloomFilter(idx_t key_count);
+	//! Creates a Bloom filter from an existing set of blocks
+	explicit BloomFilter(vector<uint64_t> blocks);
+
+public:
+	//! Returns the size in bytes of a Bloom filter that is sized for "key_count" keys
+	static idx_t GetSizeInBytes(idx_t key_count);
+	//! Inserts a set of hashes into the filter - this is not thread-safe and should only be used while building
+	void Insert(const hash_t *hashes, idx_t count);
+	//! Whether or not a key with the given hash might be in the set
+	bool Lookup(hash_t hash) const;
+	//! Narrows down "sel" to the (non-NULL) rows of the vector that might be in the set
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+	             idx_t &approved_tuple_count) const;
+
+	const vector<uint64_t> &GetBlocks() const {
+		return *blocks;
+	}
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	explicit BloomFilter(shared_ptr<vector<uint64_t>> blocks);
+
+	//! The blocks of the filter - these are immutable after construction, and shared between copies of the filter
+	shared_ptr<vector<uint64_t>> blocks;
+	//! The mask used to select a block from a hash
+	hash_t block_mask;
+};
+
+} // namespace duckdb
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class SelectionVector;
+class Vector;
+struct UnifiedVectorFormat;
+
+//! The InFilter checks whether values are in a (small) set of constants, e.g. the keys of a hash join build side
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+	~InFilter() override;
+
+	//! The (distinct, non-NULL) values of the set
+	vector<Value> values;
+
+public:
+	//! Narrows down "sel" to the rows of the vector that are in the set
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+	             idx_t &approved_tuple_count) const;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	template <class T>
+	idx_t TemplatedFilter(UnifiedVectorFormat &vdata, const hash_t *hashes, SelectionVector &sel,
+	                      idx_t &approved_tuple_count) const;
+
+	//! The values, stored in a flat vector
+	unique_ptr<Vector> value_vector;
+	//! The hashes of the values
+	vector<hash_t> value_hashes;
+	//! Linear probing hash table over the values - each slot holds an index into "values" (or INVALID_INDEX)
+	vector<idx_t> slots;
+	//! The mask used to select a slot from a hash
+	hash_t slot_mask;
+};
+
+} // namespace duckdb
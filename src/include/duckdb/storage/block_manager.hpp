@@ -20,8 +20,20 @@ class BlockHandle;
 class BufferManager;
 class ClientContext;
 class DatabaseInstance;
+class FileBuffer;
 class MetadataManager;
 
+//! A range of consecutive blocks that is read into a buffer as part of a batched read
+struct BlockReadRange {
+	BlockReadRange(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	FileBuffer &buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -58,6 +70,9 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read the content of several ranges of blocks from disk. Block managers can override this to issue the reads
+	//! at once, the default implementation reads the ranges one-by-one.
+	virtual void ReadBlockBatch(vector<BlockReadRange> &ranges);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -140,6 +140,12 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! The eviction queue (of the queues for this buffer type) that holds the latest eviction node
+	idx_t eviction_queue_idx;
+	//! Whether the block was pinned again after it was unpinned since it was loaded (used by the 2Q eviction policy)
+	bool re_referenced;
+	//! Whether the block was loaded by a prefetch or read-ahead and has not been pinned since
+	bool prefetched;
 	//! When to destroy the data buffer
 	DestroyBufferUpon destroy_buffer_upon;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/block_prefetcher.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+
+namespace duckdb {
+class BlockHandle;
+class BufferManager;
+
+//! The BlockPrefetcher loads blocks into the buffer pool with tasks that are run by the TaskScheduler, so that the
+//! threads that later pin these blocks do not stall on synchronous reads. Prefetching is a performance suggestion:
+//! blocks that cannot be loaded because there is not enough memory are skipped.
+class BlockPrefetcher {
+public:
+	BlockPrefetcher(ClientContext &context, BufferManager &buffer_manager);
+	~BlockPrefetcher();
+
+public:
+	//! Schedule a set of blocks to be loaded in the background. Throws the error of a previous prefetch (if any).
+	void Prefetch(vector<shared_ptr<BlockHandle>> blocks);
+
+private:
+	BufferManager &buffer_manager;
+	//! The executor of the prefetch tasks
+	TaskExecutor executor;
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -41,7 +42,7 @@ class BufferPool {
 	friend class StandardBufferManager;
 
 public:
-	explicit BufferPool(idx_t maximum_memory, bool track_eviction_timestamps);
+	BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, BufferEvictionPolicy eviction_policy);
 	virtual ~BufferPool();
 
 	//! Set a new memory limit to the buffer pool, throws an exception if the new limit is too low and not enough
@@ -61,6 +62,15 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy that decides which blocks are evicted first, this resets the buffer hit/miss counters
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! The number of pins of loaded blocks with the specified tag under the current eviction policy
+	idx_t GetBufferHits(MemoryTag tag) const;
+	//! The number of pins of blocks with the specified tag that had to be loaded under the current eviction policy
+	idx_t GetBufferMisses(MemoryTag tag) const;
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -80,15 +90,21 @@ protected:
 	//! Purge all blocks that haven't been pinned within the last N seconds
 	idx_t PurgeAgedBlocks(uint32_t max_age_sec);
 	idx_t PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age_sec, int64_t now, int64_t limit);
-	//! Garbage collect dead nodes in the eviction queue.
+	//! Garbage collect dead nodes in the eviction queues of the specified type.
 	void PurgeQueue(FileBufferType type);
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
-	//! Gets the eviction queue for the specified type
-	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Register a pin of a block handle (while holding its lock), hit indicates whether the block was already loaded
+	void RegisterPin(BlockHandle &handle, bool hit);
+	//! Gets the eviction queue with the specified index for the specified type
+	EvictionQueue &GetEvictionQueueForType(FileBufferType type, idx_t queue_idx = 0);
+	//! Gets the number of eviction queues for the specified type
+	static idx_t GetEvictionQueueCount(FileBufferType type);
+	//! Increments the dead nodes for the queue that holds the latest eviction node of the block handle
+	void IncrementDeadNodes(const BlockHandle &handle);
+	//! Releases the protected queue memory of a block handle (while holding its lock), if it is in the protected queue
+	void RemoveFromProtectedQueue(BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -142,8 +158,18 @@ protected:
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! The policy that decides which blocks are evicted first
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Eviction queues, persistent blocks have a probationary queue and a protected queue (used by the 2Q policy)
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The memory of the loaded blocks in the protected queue, at most 3/4 of the maximum memory
+	static constexpr idx_t PROTECTED_QUEUE_MEMORY_DIVISOR = 4;
+	static constexpr idx_t PROTECTED_QUEUE_MEMORY_MULTIPLIER = 3;
+	atomic<idx_t> protected_memory;
+	//! The number of pins of loaded blocks per memory tag
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_hits;
+	//! The number of pins of unloaded blocks per memory tag
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_misses;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
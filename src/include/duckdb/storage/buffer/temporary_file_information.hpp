@@ -9,11 +9,22 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The number of pins of loaded blocks since the eviction policy was set
+	idx_t buffer_hits;
+	//! The number of pins of blocks that had to be loaded since the eviction policy was set
+	idx_t buffer_misses;
 };
 
 struct TemporaryFileInformation {
 	string path;
+	//! The size of the file on disk
 	idx_t size;
+	//! The size of the block slots in the file
+	idx_t block_size;
+	//! The number of blocks stored in the file
+	idx_t block_count;
+	//! The size of the blocks stored in the file before compression
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
@@ -41,6 +41,9 @@ public:
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	//! Prefetch a series of blocks. Note that this is a performance suggestion.
 	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles) = 0;
+	//! Load a series of blocks ahead of their use in the background. Unlike Prefetch, this also loads blocks that
+	//! cannot be read together with adjacent blocks. Note that this is a performance suggestion.
+	virtual void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) = 0;
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
 
 	//! Returns the currently allocated memory
@@ -94,6 +97,8 @@ public:
 	}
 	//! Returns the maximum available memory for a given query
 	idx_t GetQueryMaxMemory() const;
+	//! Returns the maximum available memory for a query of the given client (bounded by its query_memory_limit)
+	idx_t GetQueryMaxMemory(ClientContext &context) const;
 
 	//! Get the manager that assigns reservations for temporary memory, e.g., for query intermediates
 	virtual TemporaryMemoryManager &GetTemporaryMemoryManager();
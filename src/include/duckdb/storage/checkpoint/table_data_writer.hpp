@@ -36,6 +36,8 @@ public:
 
 	virtual void AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer);
 	virtual CheckpointType GetCheckpointType() const = 0;
+	//! Returns the block id from which data should be relocated, if the checkpoint defragments the file
+	virtual optional_idx GetDefragmentBoundary() const = 0;
 
 	TaskScheduler &GetScheduler();
 	DatabaseInstance &GetDatabase();
@@ -55,6 +57,7 @@ public:
 	void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) override;
 	unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) override;
 	CheckpointType GetCheckpointType() const override;
+	optional_idx GetDefragmentBoundary() const override;
 
 private:
 	SingleFileCheckpointWriter &checkpoint_manager;
@@ -97,7 +97,8 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileTableDataWriter;
 
 public:
-	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type);
+	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, CheckpointType checkpoint_type,
+	                           bool defragment = false);
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
@@ -111,6 +112,10 @@ public:
 	CheckpointType GetCheckpointType() const {
 		return checkpoint_type;
 	}
+	//! If set, data stored in blocks at or after this block id is relocated during the checkpoint
+	optional_idx GetDefragmentBoundary() const {
+		return defragment_boundary;
+	}
 
 public:
 	void WriteTable(TableCatalogEntry &table, Serializer &serializer) override;
@@ -125,6 +130,10 @@ private:
 	PartialBlockManager partial_block_manager;
 	//! Checkpoint type
 	CheckpointType checkpoint_type;
+	//! Whether or not data is relocated towards the start of the file
+	bool defragment;
+	//! The block id from which data is relocated - this is the amount of blocks in use when the checkpoint starts
+	optional_idx defragment_boundary;
 	//! Block usage count for verification purposes
 	unordered_map<block_id_t, idx_t> verify_block_usage_count;
 };
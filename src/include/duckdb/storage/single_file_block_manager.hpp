@@ -67,6 +67,8 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Read the content of several ranges of blocks with a single batched read
+	void ReadBlockBatch(vector<BlockReadRange> &ranges) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -94,6 +96,8 @@ private:
 	void Initialize(const DatabaseHeader &header, const optional_idx block_alloc_size);
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
+	//! Verify the checksums of a range of blocks that was read into a buffer
+	void VerifyBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count);
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
 
 	idx_t GetBlockLocation(block_id_t block_id);
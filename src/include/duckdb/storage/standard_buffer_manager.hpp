@@ -34,6 +34,10 @@ class StandardBufferManager : public BufferManager {
 	friend class BlockHandle;
 	friend class BlockManager;
 
+public:
+	//! The maximum amount of blocks that Prefetch reads with a single batched read
+	static constexpr const idx_t MAX_BATCH_READ_BLOCKS = 64;
+
 public:
 	StandardBufferManager(DatabaseInstance &db, string temp_directory);
 	~StandardBufferManager() override;
@@ -70,6 +74,7 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
 	void Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
+	void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
@@ -151,8 +156,13 @@ protected:
 	//! overwrites the data within with garbage. Any readers that do not hold the pin will notice
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
 
+	//! Loads the given blocks with batched reads (used by Prefetch and ReadAhead)
+	void LoadBlocks(vector<shared_ptr<BlockHandle>> &handles, bool read_single_blocks);
+	//! Reads the given ranges of adjacent blocks with a single batched read, and loads them into their block handles
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-	               block_id_t first_block, block_id_t last_block);
+	               const vector<pair<block_id_t, block_id_t>> &block_ranges, bool read_single_blocks);
+	//! Reads the given blocks from the temporary files with batched reads, and loads them into their block handles
+	void BatchReadTemporary(vector<shared_ptr<BlockHandle>> &handles);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
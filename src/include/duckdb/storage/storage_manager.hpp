@@ -34,8 +34,8 @@ public:
 
 	//! Revert the commit
 	virtual void RevertCommit() = 0;
-	// Make the commit persistent
-	virtual void FlushCommit() = 0;
+	// Make the commit persistent - for a group commit, the WAL is written but the caller is responsible for syncing it
+	virtual void FlushCommit(bool group_commit) = 0;
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                             unique_ptr<PersistentCollectionData> row_group_data) = 0;
@@ -49,12 +49,14 @@ public:
 struct CheckpointOptions {
 	CheckpointOptions()
 	    : wal_action(CheckpointWALAction::DONT_DELETE_WAL), action(CheckpointAction::CHECKPOINT_IF_REQUIRED),
-	      type(CheckpointType::FULL_CHECKPOINT) {
+	      type(CheckpointType::FULL_CHECKPOINT), defragment(false) {
 	}
 
 	CheckpointWALAction wal_action;
 	CheckpointAction action;
 	CheckpointType type;
+	//! Whether or not to relocate data towards the start of the file, so that the file can be truncated
+	bool defragment;
 };
 
 //! StorageManager is responsible for managing the physical storage of the
@@ -33,6 +33,8 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! The statistics of every full vector of the column (if vector zonemaps are enabled)
+	vector<BaseStatistics> vector_stats;
 
 protected:
 	PartialBlockManager &partial_block_manager;
@@ -162,6 +162,10 @@ public:
 	virtual void Verify(RowGroup &parent);
 
 	FilterPropagateResult CheckZonemap(TableFilter &filter);
+	//! Check the filter against the per-vector statistics of the given vector (if any)
+	FilterPropagateResult CheckVectorZonemap(idx_t vector_index, TableFilter &filter);
+	//! Returns a copy of the per-vector statistics of the column
+	vector<BaseStatistics> GetVectorStatistics() const;
 
 	static shared_ptr<ColumnData> CreateColumn(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                           idx_t start_row, const LogicalType &type,
@@ -206,6 +210,10 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! The min/max statistics of every (full) vector of the column, stored when the column was checkpointed
+	vector<BaseStatistics> vector_stats;
+	//! Whether or not vector_stats is non-empty, so scans can skip the stats lock if it is empty
+	atomic<bool> has_vector_stats;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -224,6 +232,8 @@ struct PersistentColumnData {
 	PhysicalType physical_type;
 	vector<DataPointer> pointers;
 	vector<PersistentColumnData> child_columns;
+	//! The (optional) statistics of every vector of the column
+	vector<BaseStatistics> vector_stats;
 	bool has_updates = false;
 
 	void Serialize(Serializer &serializer) const;
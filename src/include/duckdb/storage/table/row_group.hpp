@@ -40,6 +40,7 @@ struct PersistentRowGroupData;
 struct RowGroupPointer;
 struct TransactionData;
 class CollectionScanState;
+struct PrefetchState;
 class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
@@ -107,6 +108,9 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Adds the blocks of the scanned columns of this row group to the prefetch state, unless the zonemaps show that
+	//! the row group will be skipped by the scan
+	void InitializePrefetch(PrefetchState &prefetch_state, CollectionScanState &state);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(ScanFilterInfo &filters);
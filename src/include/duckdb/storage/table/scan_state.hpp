@@ -34,6 +34,7 @@ class ColumnData;
 class DuckTransaction;
 class RowGroupSegmentTree;
 class TableFilter;
+class BlockPrefetcher;
 struct AdaptiveFilterState;
 struct TableScanOptions;
 
@@ -82,6 +83,8 @@ struct ColumnScanState {
 	idx_t internal_index = 0;
 	//! Segment scan state
 	unique_ptr<SegmentScanState> scan_state;
+	//! The block of the current segment at the time its SegmentScanState was initialized
+	optional_ptr<BlockHandle> scan_block;
 	//! Child states of the vector
 	vector<ColumnScanState> child_states;
 	//! Whether or not InitializeState has been called for this segment
@@ -245,6 +248,7 @@ private:
 
 struct ParallelCollectionScanState {
 	ParallelCollectionScanState();
+	~ParallelCollectionScanState();
 
 	//! The row group collection we are scanning
 	RowGroupCollection *collection;
@@ -254,6 +258,10 @@ struct ParallelCollectionScanState {
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
 	mutex lock;
+	//! The next row group whose blocks should be prefetched (if scan_prefetch_depth is set)
+	RowGroup *prefetch_row_group;
+	//! Loads the blocks of the upcoming row groups in the background
+	unique_ptr<BlockPrefetcher> prefetcher;
 };
 
 struct ParallelTableScanState {
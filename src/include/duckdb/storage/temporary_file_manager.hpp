@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -37,6 +37,8 @@ public:
 	//! Returns true if the max_index has been altered
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
+	//! Returns the number of block indexes that are currently in use
+	idx_t GetBlockCount();
 	bool HasFreeBlocks();
 
 private:
@@ -45,6 +47,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size of a block on disk, used to register the size of the temporary files with the manager
+	idx_t block_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -75,7 +79,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +92,17 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes the buffer to the slot of the given index, or the compressed buffer if it is set
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, optional_ptr<FileBuffer> compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! Reads the buffers in the slots of the given indexes with a single batched read
+	vector<unique_ptr<FileBuffer>> ReadTemporaryBuffers(const vector<idx_t> &block_indexes,
+	                                                    vector<unique_ptr<FileBuffer>> &reusable_buffers);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	//! The size of the slots in this file, smaller than the block alloc size if the file holds compressed blocks
+	idx_t GetSlotSize() const;
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -101,7 +111,9 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	const idx_t slot_size;
 	DatabaseInstance &db;
+	TemporaryFileManager &manager;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
 	string path;
@@ -148,6 +160,9 @@ public:
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
+	//! Reads the buffers of the given blocks, batching the reads per temporary file
+	vector<unique_ptr<FileBuffer>> ReadTemporaryBuffers(const vector<block_id_t> &ids,
+	                                                    vector<unique_ptr<FileBuffer>> &reusable_buffers);
 	void DeleteTemporaryBuffer(block_id_t id);
 	vector<TemporaryFileInformation> GetTemporaryFiles();
 	idx_t GetTotalUsedSpaceInBytes();
@@ -157,6 +172,11 @@ public:
 	void IncreaseSizeOnDisk(idx_t amount);
 	//! Register temporary file size decrease
 	void DecreaseSizeOnDisk(idx_t amount);
+	//! Get a buffer of the given size to (de)compress a block, reusing a buffer of an earlier read or write if possible
+	//! The memory of the buffer is charged to the buffer pool
+	unique_ptr<FileBuffer> GetCompressionBuffer(idx_t size);
+	//! Return a compression buffer so it can be reused, or free it if enough buffers are kept around already
+	void ReturnCompressionBuffer(unique_ptr<FileBuffer> buffer);
 
 private:
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
@@ -164,10 +184,15 @@ private:
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
-
 private:
 	DatabaseInstance &db;
+	//! The buffer pool that the memory of the compression buffers is charged to
+	BufferPool &buffer_pool;
 	mutex manager_lock;
+	//! Lock for the compression buffers
+	mutex compression_buffers_lock;
+	//! The compression buffers that are not in use, at most one per thread is kept around
+	vector<unique_ptr<FileBuffer>> compression_buffers;
 	//! The temporary directory
 	string temp_directory;
 	//! The set of active temporary file handles
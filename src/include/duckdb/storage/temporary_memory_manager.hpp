@@ -24,7 +24,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t query_memory_limit, idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -54,6 +55,10 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client whose query this state belongs to
+	ClientContext &context;
+	//! Max memory that all states of the query of the client can reserve together (query_memory_limit)
+	const idx_t query_memory_limit;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -110,6 +115,8 @@ private:
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Computes optimal reservation of a TemporaryMemoryState based on a cost function
 	idx_t ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const;
+	//! Computes the memory that the query of a state can still reserve within its query_memory_limit (must hold lock)
+	idx_t GetQueryFreeMemory(const TemporaryMemoryState &temporary_memory_state) const;
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
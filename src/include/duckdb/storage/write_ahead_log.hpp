@@ -20,6 +20,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -112,7 +114,12 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
-	void Flush();
+	//! Writes a flush marker and makes the WAL durable - for a group commit, the WAL is only written to the file and
+	//! the caller is expected to call WaitForSync afterwards
+	void Flush(bool group_commit = false);
+	//! Waits until the WAL is durable up to (at least) the given number of written bytes. Concurrent callers are
+	//! grouped into a single fsync
+	void WaitForSync(idx_t written_bytes);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +130,13 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! The number of bytes that have been flushed to the file, and the number of bytes that are known to be durable
+	atomic<idx_t> flushed_bytes;
+	idx_t synced_bytes;
+	//! Lock and condition variable used to group concurrent syncs
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	bool sync_in_progress;
 };
 
 } // namespace duckdb
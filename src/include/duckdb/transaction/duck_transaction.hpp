@@ -50,9 +50,9 @@ public:
 	bool ShouldWriteToWAL(AttachedDatabase &db);
 	ErrorData WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCommitState> &commit_state) noexcept;
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
-	//! commit failed, or an empty string if the commit was sucessful
-	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id,
-	                 unique_ptr<StorageCommitState> commit_state) noexcept;
+	//! commit failed, or an empty string if the commit was sucessful. For a group commit, the WAL is not synced.
+	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id, unique_ptr<StorageCommitState> commit_state,
+	                 bool group_commit) noexcept;
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties);
 
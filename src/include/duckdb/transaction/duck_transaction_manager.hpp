@@ -11,6 +11,10 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class DuckTransaction;
@@ -33,6 +37,8 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Checkpoint the database and relocate data towards the start of the file, so that the file can be truncated
+	void DefragmentCheckpoint(ClientContext &context);
 
 	transaction_t LowestActiveId() const {
 		return lowest_active_id;
@@ -43,6 +49,10 @@ public:
 	transaction_t GetLastCommit() const {
 		return last_commit;
 	}
+	//! The commit timestamp of the last transaction that made changes to the database
+	transaction_t GetLastWriteCommit() const {
+		return last_write_commit;
+	}
 
 	bool IsDuckTransactionManager() override {
 		return true;
@@ -58,6 +68,9 @@ public:
 	void PushCatalogEntry(Transaction &transaction_p, CatalogEntry &entry, data_ptr_t extra_data = nullptr,
 	                      idx_t extra_data_size = 0);
 
+	//! Stops the background checkpoint thread (if any), waiting for a running checkpoint to finish
+	void StopBackgroundCheckpoints();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -67,8 +80,14 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether a checkpoint should be performed by the background checkpoint thread after committing
+		bool checkpoint_in_background = false;
 	};
 
+private:
+	//! The amount of failed attempts after which a background checkpoint blocks new write transactions (~1 second)
+	static constexpr const idx_t MAX_BACKGROUND_CHECKPOINT_ATTEMPTS = 100;
+
 private:
 	//! Generates a new commit timestamp
 	transaction_t GetCommitTimestamp();
@@ -81,6 +100,16 @@ private:
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
 
+	void CheckpointInternal(ClientContext &context, bool force, bool defragment);
+
+	//! Request a checkpoint from the background checkpoint thread, starting the thread if required
+	void ScheduleBackgroundCheckpoint();
+	//! The main loop of the background checkpoint thread
+	void RunBackgroundCheckpoints();
+	//! Checkpoints if no write transactions are active - returns false if the checkpoint needs to be retried
+	//! If block_writers is set, new write transactions are blocked and the active ones are waited for instead
+	bool TryBackgroundCheckpoint(bool block_writers);
+
 private:
 	//! The current start timestamp used by transactions
 	transaction_t current_start_timestamp;
@@ -92,6 +121,8 @@ private:
 	atomic<transaction_t> lowest_active_start;
 	//! The last commit timestamp
 	atomic<transaction_t> last_commit;
+	//! The last commit timestamp of a transaction that made changes
+	atomic<transaction_t> last_write_commit;
 	//! Set of currently running transactions
 	vector<unique_ptr<DuckTransaction>> active_transactions;
 	//! Set of recently committed transactions
@@ -110,6 +141,19 @@ private:
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
 
+	//! Lock protecting the state of the background checkpoint thread
+	mutex background_checkpoint_lock;
+	//! Used to wake up the background checkpoint thread
+	std::condition_variable background_checkpoint_cv;
+	//! Whether a background checkpoint has been requested
+	bool background_checkpoint_requested = false;
+	//! Whether the background checkpoint thread should stop
+	bool background_checkpoint_shutdown = false;
+	//! The background checkpoint thread, started on the first request
+	unique_ptr<thread> background_checkpoint_thread;
+	//! The error of a failed background checkpoint, reported by the next explicit checkpoint
+	ErrorData background_checkpoint_error;
+
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
 	}
@@ -220,6 +220,10 @@ void AttachedDatabase::Close() {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// the background checkpoint thread must be done before we checkpoint on shutdown
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpoints();
+	}
 	if (Exception::UncaughtException()) {
 		return;
 	}
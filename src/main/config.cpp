@@ -59,6 +59,8 @@ bool DBConfigOptions::debug_print_bindings = false;
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
@@ -86,9 +88,11 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
+    DUCKDB_LOCAL(EnableJoinBuildCacheSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
+    DUCKDB_GLOBAL(EnableVectorZonemapsSetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
@@ -107,11 +111,17 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(IEEEFloatingPointOpsSetting),
     DUCKDB_GLOBAL(ImmediateTransactionModeSetting),
     DUCKDB_LOCAL(IntegerDivisionSetting),
+    DUCKDB_LOCAL(JoinBloomFilterThreshold),
+    DUCKDB_GLOBAL(JoinBuildCacheSize),
+    DUCKDB_LOCAL(JoinInFilterThreshold),
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_LOCAL(StreamingBufferSize),
+    DUCKDB_LOCAL(QueryMemoryLimitSetting),
+    DUCKDB_LOCAL(ScanPrefetchDepthSetting),
     DUCKDB_GLOBAL(MaximumMemorySetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
     DUCKDB_GLOBAL(MaximumVacuumTasks),
+    DUCKDB_GLOBAL(VacuumRewriteThreshold),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
     DUCKDB_GLOBAL(OldImplicitCasting),
@@ -136,8 +146,12 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
+    DUCKDB_GLOBAL(UseDirectIOSetting),
+    DUCKDB_GLOBAL(WALGroupCommitSetting),
+    DUCKDB_GLOBAL(WALGroupCommitMaxWaitSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL(ArrowOutputListView),
     DUCKDB_GLOBAL(LosslessConversionArrow),
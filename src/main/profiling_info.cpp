@@ -110,7 +110,7 @@ string ProfilingInfo::GetMetricAsString(MetricsType setting) const {
 
 	if (setting == MetricsType::EXTRA_INFO) {
 		string result;
-		for (auto &it : extra_info) {
+		for (auto &it : GetExtraInfo()) {
 			if (!result.empty()) {
 				result += ", ";
 			}
@@ -130,6 +130,17 @@ string ProfilingInfo::GetMetricAsString(MetricsType setting) const {
 	return metrics.at(setting).ToString();
 }
 
+InsertionOrderPreservingMap<string> ProfilingInfo::GetExtraInfo() const {
+	if (counters.empty()) {
+		return extra_info;
+	}
+	auto result = extra_info;
+	for (auto &counter : counters) {
+		result[counter.first] = to_string(counter.second);
+	}
+	return result;
+}
+
 void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest) {
 	for (auto &metric : settings) {
 		auto metric_str = StringUtil::Lower(EnumUtil::ToString(metric));
@@ -139,8 +150,9 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 		if (metric == MetricsType::EXTRA_INFO) {
 			auto extra_info_obj = yyjson_mut_obj(doc);
 
-			for (auto &it : extra_info) {
-				auto &key = it.first;
+			for (auto &it : GetExtraInfo()) {
+				// the extra info is a copy that does not outlive the document, so the key is copied as well
+				auto key = yyjson_mut_get_str(yyjson_mut_strcpy(doc, it.first.c_str()));
 				auto &value = it.second;
 				auto splits = StringUtil::Split(value, "\n");
 				if (splits.size() > 1) {
@@ -148,9 +160,9 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 					for (auto &split : splits) {
 						yyjson_mut_arr_add_strcpy(doc, list_items, split.c_str());
 					}
-					yyjson_mut_obj_add_val(doc, extra_info_obj, key.c_str(), list_items);
+					yyjson_mut_obj_add_val(doc, extra_info_obj, key, list_items);
 				} else {
-					yyjson_mut_obj_add_strcpy(doc, extra_info_obj, key.c_str(), value.c_str());
+					yyjson_mut_obj_add_strcpy(doc, extra_info_obj, key, value.c_str());
 				}
 			}
 			yyjson_mut_obj_add_val(doc, dest, key_ptr, extra_info_obj);
@@ -371,6 +371,13 @@ OperatorInformation &OperatorProfiler::GetOperatorInfo(const PhysicalOperator &p
 	}
 }
 
+void OperatorProfiler::AddCounter(const PhysicalOperator &phys_op, const string &counter_name, idx_t value) {
+	if (!enabled) {
+		return;
+	}
+	GetOperatorInfo(phys_op).AddCounter(counter_name, value);
+}
+
 void OperatorProfiler::Flush(const PhysicalOperator &phys_op) {
 	auto entry = timings.find(phys_op);
 	if (entry == timings.end()) {
@@ -414,6 +421,13 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		if (profiler.HasOperatorSetting(MetricsType::RESULT_SET_SIZE)) {
 			tree_node.GetProfilingInfo().AddToMetric<idx_t>(MetricsType::RESULT_SET_SIZE, node.second.result_set_size);
 		}
+		auto &info = tree_node.GetProfilingInfo();
+		if (info.Enabled(MetricsType::EXTRA_INFO)) {
+			// Sum up the operator-specific counters of all threads
+			for (auto &counter : node.second.counters) {
+				info.counters[counter.first] += counter.second;
+			}
+		}
 	}
 	profiler.timings.clear();
 }
@@ -79,6 +79,60 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Upper(input.ToString());
+	if (parameter == "2Q") {
+		parameter = EnumUtil::ToString(BufferEvictionPolicy::TWO_QUEUE);
+	}
+	try {
+		config.options.buffer_eviction_policy = EnumUtil::FromString<BufferEvictionPolicy>(parameter);
+	} catch (NotImplementedException &) {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or 2Q.", input.ToString());
+	}
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return "lru";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unknown buffer eviction policy setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Access Mode
 //===--------------------------------------------------------------------===//
@@ -663,6 +717,21 @@ Value EnableHTTPMetadataCacheSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.http_metadata_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Join Build Cache
+//===--------------------------------------------------------------------===//
+void EnableJoinBuildCacheSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_join_build_cache = input.GetValue<bool>();
+}
+
+void EnableJoinBuildCacheSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_join_build_cache = ClientConfig().enable_join_build_cache;
+}
+
+Value EnableJoinBuildCacheSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_join_build_cache);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable Profiling
 //===--------------------------------------------------------------------===//
@@ -923,6 +992,22 @@ Value EnableProgressBarPrintSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).print_progress_bar);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Vector Zonemaps
+//===--------------------------------------------------------------------===//
+void EnableVectorZonemapsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_vector_zonemaps = input.GetValue<bool>();
+}
+
+void EnableVectorZonemapsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_vector_zonemaps = DBConfig().options.enable_vector_zonemaps;
+}
+
+Value EnableVectorZonemapsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_vector_zonemaps);
+}
+
 //===--------------------------------------------------------------------===//
 // Errors As JSON
 //===--------------------------------------------------------------------===//
@@ -1299,6 +1384,41 @@ Value StreamingBufferSize::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.streaming_buffer_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.query_memory_limit == NumericLimits<idx_t>::Maximum()) {
+		return Value("none");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Scan Prefetch Depth
+//===--------------------------------------------------------------------===//
+void ScanPrefetchDepthSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).scan_prefetch_depth = UBigIntValue::Get(input);
+}
+
+void ScanPrefetchDepthSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).scan_prefetch_depth = ClientConfig().scan_prefetch_depth;
+}
+
+Value ScanPrefetchDepthSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).scan_prefetch_depth);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Temp Directory Size
 //===--------------------------------------------------------------------===//
@@ -1360,6 +1480,76 @@ Value MaximumVacuumTasks::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.max_vacuum_tasks);
 }
 
+//===--------------------------------------------------------------------===//
+// Vacuum Rewrite Threshold
+//===--------------------------------------------------------------------===//
+void VacuumRewriteThreshold::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold < 0 || threshold > 1.0) {
+		throw InvalidInputException("the vacuum rewrite threshold must be within [0, 1]");
+	}
+	config.options.vacuum_rewrite_threshold = threshold;
+}
+
+void VacuumRewriteThreshold::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.vacuum_rewrite_threshold = DBConfig().options.vacuum_rewrite_threshold;
+}
+
+Value VacuumRewriteThreshold::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.vacuum_rewrite_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Join Bloom Filter Threshold
+//===--------------------------------------------------------------------===//
+void JoinBloomFilterThreshold::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.join_bloom_filter_threshold = input.GetValue<idx_t>();
+}
+
+void JoinBloomFilterThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).join_bloom_filter_threshold = ClientConfig().join_bloom_filter_threshold;
+}
+
+Value JoinBloomFilterThreshold::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.join_bloom_filter_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Join Build Cache Size
+//===--------------------------------------------------------------------===//
+void JoinBuildCacheSize::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.join_build_cache_size = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void JoinBuildCacheSize::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.join_build_cache_size = DBConfig().options.join_build_cache_size;
+}
+
+Value JoinBuildCacheSize::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.join_build_cache_size));
+}
+
+//===--------------------------------------------------------------------===//
+// Join In Filter Threshold
+//===--------------------------------------------------------------------===//
+void JoinInFilterThreshold::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.join_in_filter_threshold = input.GetValue<idx_t>();
+}
+
+void JoinInFilterThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).join_in_filter_threshold = ClientConfig().join_in_filter_threshold;
+}
+
+Value JoinInFilterThreshold::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.join_in_filter_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Merge Join Threshold
 //===--------------------------------------------------------------------===//
@@ -1862,6 +2052,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1905,6 +2111,54 @@ Value UsernameSetting::GetSetting(const ClientContext &context) {
 	return Value();
 }
 
+//===--------------------------------------------------------------------===//
+// Use Direct IO
+//===--------------------------------------------------------------------===//
+void UseDirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.use_direct_io = input.GetValue<bool>();
+}
+
+void UseDirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.use_direct_io = DBConfig().options.use_direct_io;
+}
+
+Value UseDirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = input.GetValue<bool>();
+}
+
+void WALGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WALGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Max Wait
+//===--------------------------------------------------------------------===//
+void WALGroupCommitMaxWaitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_max_wait = input.GetValue<uint64_t>();
+}
+
+void WALGroupCommitMaxWaitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_max_wait = DBConfig().options.wal_group_commit_max_wait;
+}
+
+Value WALGroupCommitMaxWaitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_max_wait);
+}
+
 //===--------------------------------------------------------------------===//
 // Allocator Flush Threshold
 //===--------------------------------------------------------------------===//
@@ -1,5 +1,7 @@
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_distinct.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
@@ -15,6 +17,100 @@ namespace duckdb {
 JoinFilterPushdownOptimizer::JoinFilterPushdownOptimizer(Optimizer &optimizer) : optimizer(optimizer) {
 }
 
+static bool ProducesBinding(LogicalOperator &op, const ColumnBinding &binding) {
+	for (auto &op_binding : op.GetColumnBindings()) {
+		if (op_binding == binding) {
+			return true;
+		}
+	}
+	return false;
+}
+
+optional_ptr<LogicalGet> JoinFilterPushdownOptimizer::RouteFilter(LogicalOperator &op, ColumnBinding &binding,
+                                                                   bool &crosses_pipeline) {
+	reference<LogicalOperator> probe_source(op);
+	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &probe_child = probe_source.get();
+		switch (probe_child.type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			// does not affect probe side - continue into child
+			probe_source = *probe_child.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
+			// does not affect probe side, but the child is scanned in a different pipeline
+			crosses_pipeline = true;
+			probe_source = *probe_child.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_DISTINCT: {
+			// DISTINCT ON picks one row per group - filtering the input could change which row is picked
+			auto &distinct = probe_child.Cast<LogicalDistinct>();
+			if (distinct.distinct_type != DistinctType::DISTINCT) {
+				return nullptr;
+			}
+			crosses_pipeline = true;
+			probe_source = *probe_child.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+			// rows without a match for the filter do not produce any output after the join that generates the filter
+			// we can route the filter into whichever side of the intermediate join produces the column
+			if (ProducesBinding(*probe_child.children[0], binding)) {
+				probe_source = *probe_child.children[0];
+			} else if (ProducesBinding(*probe_child.children[1], binding)) {
+				// the build side is scanned in a different pipeline
+				crosses_pipeline = true;
+				probe_source = *probe_child.children[1];
+			} else {
+				return nullptr;
+			}
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			// projection - check if the expression is a column reference
+			auto &proj = probe_child.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				// index does not belong to this projection - bail-out
+				return nullptr;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				// not a simple column ref - bail-out
+				return nullptr;
+			}
+			// column-ref - pass through the new column binding
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			probe_source = *probe_child.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+			// aggregate - filtering on a group removes entire groups, as long as there is a single grouping set
+			auto &aggr = probe_child.Cast<LogicalAggregate>();
+			if (binding.table_index != aggr.group_index || aggr.grouping_sets.size() > 1) {
+				return nullptr;
+			}
+			auto &expr = *aggr.groups[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return nullptr;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			crosses_pipeline = true;
+			probe_source = *probe_child.children[0];
+			break;
+		}
+		default:
+			// unsupported child type
+			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
+			return nullptr;
+		}
+	}
+	auto &get = probe_source.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index) {
+		// the filter does not apply to this scan
+		return nullptr;
+	}
+	return &get;
+}
+
 void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
 	switch (join.join_type) {
 	case JoinType::MARK:
@@ -60,69 +156,31 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		pushdown_col.probe_column_index = colref.binding;
 		pushdown_info->filters.push_back(pushdown_col);
 	}
-	if (pushdown_info->filters.empty()) {
-		// could not generate any filters - bail-out
-		return;
-	}
-	// find the child LogicalGet (if possible)
-	reference<LogicalOperator> probe_source(*join.children[0]);
-	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
-		auto &probe_child = probe_source.get();
-		switch (probe_child.type) {
-		case LogicalOperatorType::LOGICAL_LIMIT:
-		case LogicalOperatorType::LOGICAL_FILTER:
-		case LogicalOperatorType::LOGICAL_ORDER_BY:
-		case LogicalOperatorType::LOGICAL_TOP_N:
-		case LogicalOperatorType::LOGICAL_DISTINCT:
-		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
-			// does not affect probe side - continue into left child
-			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
-			probe_source = *probe_child.children[0];
-			break;
-		case LogicalOperatorType::LOGICAL_PROJECTION: {
-			// projection - check if we all of the expressions are only column references
-			auto &proj = probe_source.get().Cast<LogicalProjection>();
-			for (auto &filter : pushdown_info->filters) {
-				if (filter.probe_column_index.table_index != proj.table_index) {
-					// index does not belong to this projection - bail-out
-					return;
-				}
-				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
-				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
-					// not a simple column ref - bail-out
-					return;
-				}
-				// column-ref - pass through the new column binding
-				auto &colref = expr.Cast<BoundColumnRefExpression>();
-				filter.probe_column_index = colref.binding;
-			}
-			probe_source = *probe_child.children[0];
-			break;
+	// route each of the filters to the LogicalGet that produces the probe column (if possible)
+	vector<JoinFilterPushdownColumn> routed_filters;
+	for (auto &filter : pushdown_info->filters) {
+		bool crosses_pipeline = false;
+		auto get = RouteFilter(*join.children[0], filter.probe_column_index, crosses_pipeline);
+		if (!get || !get->function.filter_pushdown) {
+			// the filter cannot be pushed into a scan
+			continue;
 		}
-		default:
-			// unsupported child type
-			return;
+		if (crosses_pipeline) {
+			// the scan is not part of the probe pipeline - it has to wait until the filters are generated
+			pushdown_info->probe_side_dependencies = true;
 		}
-	}
-	// found the LogicalGet
-	auto &get = probe_source.get().Cast<LogicalGet>();
-	if (!get.function.filter_pushdown) {
-		// filter pushdown is not supported - bail-out
-		return;
-	}
-	for (auto &filter : pushdown_info->filters) {
-		if (filter.probe_column_index.table_index != get.table_index) {
-			// the filter does not apply to the probe side here - bail-out
-			return;
+		// set up the dynamic filters (if we don't have any yet)
+		if (!get->dynamic_filters) {
+			get->dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 		}
+		filter.dynamic_filters = get->dynamic_filters;
+		routed_filters.push_back(std::move(filter));
 	}
-	// pushdown can be performed
-	// set up the dynamic filters (if we don't have any yet)
-	if (!get.dynamic_filters) {
-		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
+	if (routed_filters.empty()) {
+		// could not generate any filters - bail-out
+		return;
 	}
-	pushdown_info->dynamic_filters = get.dynamic_filters;
+	pushdown_info->filters = std::move(routed_filters);
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
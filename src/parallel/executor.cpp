@@ -175,6 +175,56 @@ void Executor::SchedulePipeline(const shared_ptr<MetaPipeline> &meta_pipeline, S
 	}
 }
 
+using pipeline_dependency_map_t = reference_map_t<Pipeline, vector<reference<Pipeline>>>;
+
+//! Whether 'pipeline' (transitively) has to wait until the sink of one of the 'finalized' pipelines has been finalized
+static bool WaitsForFinalize(Pipeline &pipeline, const reference_set_t<Pipeline> &finalized,
+                             const pipeline_dependency_map_t &dependencies,
+                             const pipeline_dependency_map_t &finish_dependencies, reference_set_t<Pipeline> &visited) {
+	if (!visited.insert(pipeline).second) {
+		return false;
+	}
+	auto finish_entry = finish_dependencies.find(pipeline);
+	if (finish_entry != finish_dependencies.end()) {
+		for (auto &dependency : finish_entry->second) {
+			if (finalized.find(dependency) != finalized.end() ||
+			    WaitsForFinalize(dependency, finalized, dependencies, finish_dependencies, visited)) {
+				return true;
+			}
+		}
+	}
+	auto entry = dependencies.find(pipeline);
+	if (entry != dependencies.end()) {
+		for (auto &dependency : entry->second) {
+			if (WaitsForFinalize(dependency, finalized, dependencies, finish_dependencies, visited)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+//! Whether any pipeline of 'dependant' (transitively) has to wait until the sink of 'dependency' has been finalized
+static bool WaitsForFinalize(MetaPipeline &dependant, MetaPipeline &dependency,
+                             const pipeline_dependency_map_t &dependencies,
+                             const pipeline_dependency_map_t &finish_dependencies) {
+	vector<shared_ptr<Pipeline>> dependency_pipelines;
+	dependency.GetPipelines(dependency_pipelines, false);
+	reference_set_t<Pipeline> finalized;
+	for (auto &pipeline : dependency_pipelines) {
+		finalized.insert(*pipeline);
+	}
+	vector<shared_ptr<Pipeline>> dependant_pipelines;
+	dependant.GetPipelines(dependant_pipelines, false);
+	reference_set_t<Pipeline> visited;
+	for (auto &pipeline : dependant_pipelines) {
+		if (WaitsForFinalize(*pipeline, finalized, dependencies, finish_dependencies, visited)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	auto &events = event_data.events;
 	D_ASSERT(events.empty());
@@ -202,6 +252,8 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	}
 
 	// set the dependencies for pipeline event
+	pipeline_dependency_map_t dependencies;
+	pipeline_dependency_map_t finish_dependencies;
 	for (auto &meta_pipeline : event_data.meta_pipelines) {
 		for (auto &entry : meta_pipeline->GetDependencies()) {
 			auto &pipeline = entry.first.get();
@@ -215,6 +267,35 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 				pipeline_stack.pipeline_event.AddDependency(dependency_stack.pipeline_event);
 			}
 		}
+		for (auto &entry : meta_pipeline->GetFinishDependencies()) {
+			auto &pipeline = entry.first.get();
+			auto root_entry = event_map.find(pipeline);
+			D_ASSERT(root_entry != event_map.end());
+			auto &pipeline_stack = root_entry->second;
+			for (auto &dependency : entry.second) {
+				auto event_entry = event_map.find(dependency);
+				D_ASSERT(event_entry != event_map.end());
+				auto &dependency_stack = event_entry->second;
+				pipeline_stack.pipeline_event.AddDependency(dependency_stack.pipeline_finish_event);
+				finish_dependencies[pipeline].push_back(dependency);
+			}
+		}
+	}
+	if (!finish_dependencies.empty()) {
+		// collect all other dependencies, so we can find the pipelines that (transitively) wait for a Finalize
+		for (auto &entry : event_map) {
+			auto &pipeline = entry.first.get();
+			for (auto &dependency : pipeline.dependencies) {
+				dependencies[pipeline].push_back(*dependency.lock());
+			}
+		}
+		for (auto &meta_pipeline : event_data.meta_pipelines) {
+			for (auto &entry : meta_pipeline->GetDependencies()) {
+				for (auto &dependency : entry.second) {
+					dependencies[entry.first].push_back(dependency);
+				}
+			}
+		}
 	}
 
 	// these dependencies make it so that things happen in this order:
@@ -226,6 +307,27 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	for (auto &meta_pipeline : event_data.meta_pipelines) {
 		vector<shared_ptr<MetaPipeline>> children;
 		meta_pipeline->GetMetaPipelines(children, false, true);
+
+		// if one join build waits until another join build with the same parent has been finalized (e.g., for join
+		// filters), we cannot order any of the join builds with that parent, as the order is transitive
+		reference_set_t<Pipeline> unordered_parents;
+		if (!finish_dependencies.empty()) {
+			for (auto &child1 : children) {
+				if (child1->Type() != MetaPipelineType::JOIN_BUILD) {
+					continue;
+				}
+				for (auto &child2 : children) {
+					if (child2->Type() != MetaPipelineType::JOIN_BUILD || RefersToSameObject(*child1, *child2) ||
+					    !RefersToSameObject(*child1->GetParent(), *child2->GetParent())) {
+						continue;
+					}
+					if (WaitsForFinalize(*child2, *child1, dependencies, finish_dependencies)) {
+						unordered_parents.insert(*child1->GetParent());
+					}
+				}
+			}
+		}
+
 		for (auto &child1 : children) {
 			if (child1->Type() != MetaPipelineType::JOIN_BUILD) {
 				continue; // We only want to do this for join builds
@@ -241,6 +343,9 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 				if (!RefersToSameObject(*child1->GetParent(), *child2->GetParent())) {
 					continue; // Different parents, skip
 				}
+				if (unordered_parents.find(*child1->GetParent()) != unordered_parents.end()) {
+					continue; // one of the join builds can only start once another one has been finalized
+				}
 
 				auto &child2_base = *child2->GetBasePipeline();
 				auto child2_entry = event_map.find(child2_base);
@@ -66,6 +66,10 @@ const reference_map_t<Pipeline, vector<reference<Pipeline>>> &MetaPipeline::GetD
 	return pipeline_dependencies;
 }
 
+const reference_map_t<Pipeline, vector<reference<Pipeline>>> &MetaPipeline::GetFinishDependencies() const {
+	return pipeline_finish_dependencies;
+}
+
 MetaPipelineType MetaPipeline::Type() const {
 	return type;
 }
@@ -155,7 +159,8 @@ static bool PipelineExceedsThreadCount(Pipeline &pipeline, const idx_t thread_co
 }
 
 void MetaPipeline::AddRecursiveDependencies(const vector<shared_ptr<Pipeline>> &new_dependencies,
-                                            const MetaPipeline &last_child) {
+                                            const MetaPipeline &last_child, bool add_regular_dependencies,
+                                            const reference_set_t<const PhysicalOperator> &forced_sources) {
 	if (recursive_cte) {
 		return; // let's not burn our fingers on this for now
 	}
@@ -177,7 +182,15 @@ void MetaPipeline::AddRecursiveDependencies(const vector<shared_ptr<Pipeline>> &
 	const auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(executor.context).NumberOfThreads());
 	for (; it != child_meta_pipelines.end(); it++) {
 		for (auto &pipeline : it->get()->pipelines) {
-			if (!PipelineExceedsThreadCount(*pipeline, thread_count)) {
+			if (forced_sources.find(*pipeline->GetSource()) != forced_sources.end()) {
+				// the source waits for something that the sink of the dependencies produces when it is finalized
+				auto &pipeline_deps = pipeline_finish_dependencies[*pipeline];
+				for (auto &new_dependency : new_dependencies) {
+					pipeline_deps.push_back(*new_dependency);
+				}
+				continue;
+			}
+			if (!add_regular_dependencies || !PipelineExceedsThreadCount(*pipeline, thread_count)) {
 				continue;
 			}
 			auto &pipeline_deps = pipeline_dependencies[*pipeline];
@@ -18,6 +18,9 @@ unique_ptr<VacuumInfo> VacuumInfo::Copy() {
 string VacuumInfo::ToString() const {
 	string result = "";
 	result += "VACUUM";
+	if (options.full) {
+		result += " FULL";
+	}
 	if (options.analyze) {
 		result += " ANALYZE";
 	}
@@ -18,7 +18,7 @@ VacuumOptions ParseOptions(const int32_t options) {
 		throw NotImplementedException("Freeze vacuum option");
 	}
 	if (options & duckdb_libpgquery::PGVacuumOption::PG_VACOPT_FULL) {
-		throw NotImplementedException("Full vacuum option");
+		result.full = true;
 	}
 	if (options & duckdb_libpgquery::PGVacuumOption::PG_VACOPT_NOWAIT) {
 		throw NotImplementedException("No Wait vacuum option");
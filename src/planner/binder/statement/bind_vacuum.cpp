@@ -22,6 +22,11 @@ void Binder::BindVacuumTable(LogicalVacuum &vacuum, unique_ptr<LogicalOperator>
 	auto ref = unique_ptr_cast<BoundTableRef, BoundBaseTableRef>(std::move(bound_table));
 	auto &table = ref->table;
 	vacuum.SetTable(table);
+	if (info.options.full) {
+		// VACUUM FULL only uses the table to find its database - scanning the table would lock it in this transaction
+		// and block the checkpoint that relocates the data
+		return;
+	}
 
 	vector<unique_ptr<Expression>> select_list;
 	auto &columns = info.columns;
@@ -0,0 +1,107 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(shared_ptr<vector<uint64_t>> blocks_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), blocks(std::move(blocks_p)) {
+	D_ASSERT(!blocks->empty() && IsPowerOfTwo(blocks->size()));
+	block_mask = blocks->size() - 1;
+}
+
+static idx_t BloomFilterBlockCount(idx_t key_count) {
+	return NextPowerOfTwo(MaxValue<idx_t>(key_count * BloomFilter::BITS_PER_KEY / (sizeof(uint64_t) * 8), 1));
+}
+
+BloomFilter::BloomFilter(idx_t key_count)
+    : BloomFilter(make_shared_ptr<vector<uint64_t>>(BloomFilterBlockCount(key_count), 0)) {
+}
+
+idx_t BloomFilter::GetSizeInBytes(idx_t key_count) {
+	return BloomFilterBlockCount(key_count) * sizeof(uint64_t);
+}
+
+BloomFilter::BloomFilter(vector<uint64_t> blocks_p)
+    : BloomFilter(make_shared_ptr<vector<uint64_t>>(std::move(blocks_p))) {
+}
+
+static inline uint64_t BloomFilterBits(hash_t hash) {
+	// the lower bits of the hash select the block, the upper 24 bits select four bits within the block
+	return (uint64_t(1) << ((hash >> 40) & 63)) | (uint64_t(1) << ((hash >> 46) & 63)) |
+	       (uint64_t(1) << ((hash >> 52) & 63)) | (uint64_t(1) << (hash >> 58));
+}
+
+void BloomFilter::Insert(const hash_t *hashes, idx_t count) {
+	auto data = blocks->data();
+	for (idx_t i = 0; i < count; i++) {
+		data[hashes[i] & block_mask] |= BloomFilterBits(hashes[i]);
+	}
+}
+
+bool BloomFilter::Lookup(hash_t hash) const {
+	auto bits = BloomFilterBits(hash);
+	return ((*blocks)[hash & block_mask] & bits) == bits;
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+                          idx_t &approved_tuple_count) const {
+	Vector hashes(LogicalType::HASH, scan_count);
+	VectorOperations::Hash(vector, hashes, scan_count);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(scan_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			continue;
+		}
+		if (Lookup(hash_data[hdata.sel->get_index(idx)])) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!stats.CanHaveNoNull()) {
+		// only NULL values - these never pass the filter
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(blocks->size() * sizeof(uint64_t) * 8) + " bits)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (other_p.filter_type != filter_type) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return blocks == other.blocks || *blocks == *other.blocks;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return unique_ptr<TableFilter>(new BloomFilter(blocks));
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the filter cannot be expressed exactly - we return "IS NOT NULL", which admits a superset of the rows
+	// this is fine as Bloom filters are only used to eliminate rows early, e.g. rows that have no join partner
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_IS_NOT_NULL, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	return std::move(result);
+}
+
+} // namespace duckdb
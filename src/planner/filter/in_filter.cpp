@@ -0,0 +1,195 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	auto value_count = values.size();
+	value_vector = make_uniq<Vector>(values[0].type(), value_count);
+	for (idx_t i = 0; i < value_count; i++) {
+		if (values[i].IsNull()) {
+			throw InternalException("InFilter values cannot be NULL");
+		}
+		value_vector->SetValue(i, values[i]);
+	}
+
+	// hash the values and insert them into the hash table
+	Vector hashes(LogicalType::HASH, value_count);
+	VectorOperations::Hash(*value_vector, hashes, value_count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	value_hashes.assign(hash_data, hash_data + value_count);
+
+	slots.resize(NextPowerOfTwo(value_count * 2), DConstants::INVALID_INDEX);
+	slot_mask = slots.size() - 1;
+	for (idx_t i = 0; i < value_count; i++) {
+		auto slot = value_hashes[i] & slot_mask;
+		while (slots[slot] != DConstants::INVALID_INDEX) {
+			slot = (slot + 1) & slot_mask;
+		}
+		slots[slot] = i;
+	}
+}
+
+InFilter::~InFilter() {
+}
+
+template <class T>
+idx_t InFilter::TemplatedFilter(UnifiedVectorFormat &vdata, const hash_t *hashes, SelectionVector &sel,
+                                idx_t &approved_tuple_count) const {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto value_data = FlatVector::GetData<T>(*value_vector);
+
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto data_idx = vdata.sel->get_index(idx);
+		if (!vdata.validity.RowIsValid(data_idx)) {
+			continue;
+		}
+		auto hash = hashes[idx];
+		for (auto slot = hash & slot_mask; slots[slot] != DConstants::INVALID_INDEX; slot = (slot + 1) & slot_mask) {
+			auto value_idx = slots[slot];
+			if (value_hashes[value_idx] == hash && Equals::Operation<T>(data[data_idx], value_data[value_idx])) {
+				new_sel.set_index(result_count++, idx);
+				break;
+			}
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+idx_t InFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+                       idx_t &approved_tuple_count) const {
+	Vector hashes(LogicalType::HASH, scan_count);
+	VectorOperations::Hash(vector, hashes, scan_count);
+	hashes.Flatten(scan_count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::BOOL:
+		return TemplatedFilter<bool>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::UINT8:
+		return TemplatedFilter<uint8_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::UINT16:
+		return TemplatedFilter<uint16_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::UINT32:
+		return TemplatedFilter<uint32_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::UINT64:
+		return TemplatedFilter<uint64_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::UINT128:
+		return TemplatedFilter<uhugeint_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::INT8:
+		return TemplatedFilter<int8_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::INT16:
+		return TemplatedFilter<int16_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::INT32:
+		return TemplatedFilter<int32_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::INT64:
+		return TemplatedFilter<int64_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::INT128:
+		return TemplatedFilter<hugeint_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::FLOAT:
+		return TemplatedFilter<float>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::DOUBLE:
+		return TemplatedFilter<double>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::INTERVAL:
+		return TemplatedFilter<interval_t>(vdata, hash_data, sel, approved_tuple_count);
+	case PhysicalType::VARCHAR:
+		return TemplatedFilter<string_t>(vdata, hash_data, sel, approved_tuple_count);
+	default:
+		throw InvalidTypeException(vector.GetType(), "Invalid type for IN filter pushed down to table scan");
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		break;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// the filter is always false if it is always false for every value in the set
+	auto result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	for (auto &value : values) {
+		FilterPropagateResult value_result;
+		if (value.type().InternalType() == PhysicalType::VARCHAR) {
+			value_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+		} else {
+			value_result = NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value);
+		}
+		if (value_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			return value_result;
+		}
+		if (value_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			result = value_result;
+		}
+	}
+	return result;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string result = column_name + " IN (";
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		result += values[i].ToSQLString();
+	}
+	return result + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (other_p.filter_type != filter_type) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	if (values.size() != other.values.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (!Value::NotDistinctFrom(values[i], other.values[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+} // namespace duckdb
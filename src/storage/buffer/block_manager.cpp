@@ -70,6 +70,12 @@ shared_ptr<BlockHandle> BlockManager::ConvertToPersistent(block_id_t block_id, s
 	return new_block;
 }
 
+void BlockManager::ReadBlockBatch(vector<BlockReadRange> &ranges) {
+	for (auto &range : ranges) {
+		ReadBlocks(range.buffer, range.start_block, range.block_count);
+	}
+}
+
 void BlockManager::UnregisterBlock(block_id_t block_id) {
 	if (block_id >= MAXIMUM_BLOCK) {
 		// in-memory buffer: buffer could have been offloaded to disk: remove the file
@@ -0,0 +1,55 @@
+#include "duckdb/storage/buffer/block_prefetcher.hpp"
+
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+class BlockPrefetchTask : public BaseExecutorTask {
+public:
+	BlockPrefetchTask(TaskExecutor &executor, BufferManager &buffer_manager, vector<shared_ptr<BlockHandle>> blocks)
+	    : BaseExecutorTask(executor), buffer_manager(buffer_manager), blocks(std::move(blocks)) {
+	}
+
+	void ExecuteTask() override {
+		try {
+			buffer_manager.ReadAhead(blocks);
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (error.Type() != ExceptionType::OUT_OF_MEMORY) {
+				throw;
+			}
+			// there is not enough memory to load the blocks ahead of time - they are loaded when they are pinned
+		}
+	}
+
+private:
+	BufferManager &buffer_manager;
+	vector<shared_ptr<BlockHandle>> blocks;
+};
+
+BlockPrefetcher::BlockPrefetcher(ClientContext &context, BufferManager &buffer_manager)
+    : buffer_manager(buffer_manager), executor(context) {
+}
+
+BlockPrefetcher::~BlockPrefetcher() {
+	// the tasks refer to the executor - wait for all of them to finish
+	try {
+		executor.WorkOnTasks();
+	} catch (...) { // NOLINT
+		// errors are not thrown from the destructor: a scan that needs the blocks runs into them when pinning them
+	}
+}
+
+void BlockPrefetcher::Prefetch(vector<shared_ptr<BlockHandle>> blocks) {
+	if (executor.HasError()) {
+		executor.ThrowError();
+	}
+	if (blocks.empty()) {
+		return;
+	}
+	executor.ScheduleTask(make_uniq<BlockPrefetchTask>(executor, buffer_manager, std::move(blocks)));
+}
+
+} // namespace duckdb
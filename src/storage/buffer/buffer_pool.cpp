@@ -194,20 +194,25 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	total_dead_nodes -= actually_dequeued - alive_nodes;
 }
 
-BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
+BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps, BufferEvictionPolicy eviction_policy)
     : maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
+      eviction_policy(eviction_policy), protected_memory(0),
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
-		queues.push_back(make_uniq<EvictionQueue>());
+	for (idx_t type_idx = 1; type_idx <= FILE_BUFFER_TYPE_COUNT; type_idx++) {
+		auto queue_count = GetEvictionQueueCount(FileBufferType(type_idx));
+		for (idx_t queue_idx = 0; queue_idx < queue_count; queue_idx++) {
+			queues.push_back(make_uniq<EvictionQueue>());
+		}
+	}
+	for (idx_t k = 0; k < MEMORY_TAG_COUNT; k++) {
+		buffer_hits[k] = 0;
+		buffer_misses[k] = 0;
 	}
 }
 BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
@@ -221,19 +226,73 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		IncrementDeadNodes(*handle);
+	}
+
+	// with the 2Q policy, persistent blocks that were pinned again after being unpinned since they were loaded go into
+	// the protected queue, which is only evicted from after the probationary queue is exhausted
+	// this prevents a single large scan from evicting the working set
+	// the protected queue is capped, blocks that do not fit anymore are demoted to the probationary queue
+	RemoveFromProtectedQueue(*handle);
+	idx_t queue_idx = 0;
+	if (eviction_policy == BufferEvictionPolicy::TWO_QUEUE && handle->buffer->type == FileBufferType::BLOCK &&
+	    handle->re_referenced) {
+		auto block_memory = handle->GetMemoryUsage();
+		auto new_protected_memory = protected_memory.fetch_add(block_memory) + block_memory;
+		if (new_protected_memory <= GetMaxMemory() / PROTECTED_QUEUE_MEMORY_DIVISOR * PROTECTED_QUEUE_MEMORY_MULTIPLIER) {
+			queue_idx = 1;
+		} else {
+			protected_memory -= block_memory;
+		}
 	}
+	handle->eviction_queue_idx = queue_idx;
 
 	// Get the eviction queue for the buffer type and add it
+	auto &queue = GetEvictionQueueForType(handle->buffer->type, queue_idx);
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
-EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
-	return *queues[uint8_t(type) - 1];
+void BufferPool::RemoveFromProtectedQueue(BlockHandle &handle) {
+	if (handle.eviction_queue_idx == 0) {
+		return;
+	}
+	protected_memory -= handle.GetMemoryUsage();
+	handle.eviction_queue_idx = 0;
+}
+
+void BufferPool::RegisterPin(BlockHandle &handle, bool hit) {
+	if (hit && handle.readers == 0) {
+		if (handle.prefetched) {
+			// the first pin after a prefetch is the first actual reference to the block
+			handle.prefetched = false;
+		} else {
+			// the block was unpinned and is referenced again while it is still loaded
+			handle.re_referenced = true;
+		}
+	}
+	auto tag_idx = static_cast<idx_t>(handle.tag);
+	if (hit) {
+		buffer_hits[tag_idx].fetch_add(1, std::memory_order_relaxed);
+	} else {
+		buffer_misses[tag_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+idx_t BufferPool::GetEvictionQueueCount(FileBufferType type) {
+	return type == FileBufferType::BLOCK ? 2 : 1;
+}
+
+EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type, idx_t queue_idx) {
+	D_ASSERT(queue_idx < GetEvictionQueueCount(type));
+	idx_t offset = 0;
+	for (idx_t type_idx = 1; type_idx < uint8_t(type); type_idx++) {
+		offset += GetEvictionQueueCount(FileBufferType(type_idx));
+	}
+	return *queues[offset + queue_idx];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	GetEvictionQueueForType(handle.buffer->type, handle.eviction_queue_idx).IncrementDeadNodes();
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -256,13 +315,36 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	// blocks that are already queued stay where they are, they are moved once they are unpinned again
+	eviction_policy = policy;
+	for (idx_t k = 0; k < MEMORY_TAG_COUNT; k++) {
+		buffer_hits[k] = 0;
+		buffer_misses[k] = 0;
+	}
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+idx_t BufferPool::GetBufferHits(MemoryTag tag) const {
+	return buffer_hits[static_cast<idx_t>(tag)].load(std::memory_order_relaxed);
+}
+
+idx_t BufferPool::GetBufferMisses(MemoryTag tag) const {
+	return buffer_misses[static_cast<idx_t>(tag)].load(std::memory_order_relaxed);
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
-	auto block_result =
-	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
-	if (block_result.success) {
-		return block_result;
+	// First, we try to evict persistent table data, starting with the probationary queue
+	for (idx_t queue_idx = 0; queue_idx < GetEvictionQueueCount(FileBufferType::BLOCK); queue_idx++) {
+		auto block_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK, queue_idx), tag,
+		                                        extra_memory, memory_limit, buffer);
+		if (block_result.success) {
+			return block_result;
+		}
 	}
 
 	// If that does not succeed, we try to evict temporary data
@@ -376,7 +458,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 }
 
 void BufferPool::PurgeQueue(FileBufferType type) {
-	GetEvictionQueueForType(type).Purge();
+	for (idx_t queue_idx = 0; queue_idx < GetEvictionQueueCount(type); queue_idx++) {
+		GetEvictionQueueForType(type, queue_idx).Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -52,6 +52,10 @@ CheckpointType SingleFileTableDataWriter::GetCheckpointType() const {
 	return checkpoint_manager.GetCheckpointType();
 }
 
+optional_idx SingleFileTableDataWriter::GetDefragmentBoundary() const {
+	return checkpoint_manager.GetDefragmentBoundary();
+}
+
 void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info,
                                               Serializer &serializer) {
 
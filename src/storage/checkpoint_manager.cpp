@@ -36,9 +36,9 @@ namespace duckdb {
 void ReorderTableEntries(catalog_entry_vector_t &tables);
 
 SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager,
-                                                       CheckpointType checkpoint_type)
+                                                       CheckpointType checkpoint_type, bool defragment)
     : CheckpointWriter(db), partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT),
-      checkpoint_type(checkpoint_type) {
+      checkpoint_type(checkpoint_type), defragment(defragment) {
 }
 
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
@@ -137,6 +137,11 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 
 	auto &block_manager = GetBlockManager();
 	auto &metadata_manager = GetMetadataManager();
+	if (defragment && checkpoint_type == CheckpointType::FULL_CHECKPOINT) {
+		// data stored past the blocks that are in use is rewritten - new blocks are taken from the start of the free
+		// list, which allows the tail of the file to be truncated after the checkpoint
+		defragment_boundary = block_manager.TotalBlocks() - block_manager.FreeBlocks();
+	}
 
 	//! Set up the writers for the checkpoints
 	metadata_writer = make_uniq<MetadataWriter>(metadata_manager);
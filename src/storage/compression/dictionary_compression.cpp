@@ -441,6 +441,10 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size;
+	//! Identifies the dictionary of this segment to consumers of the emitted dictionary vectors
+	//! The dictionary is stored per segment, so every segment (and every scan of it) gets a new identifier
+	idx_t dictionary_id;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
@@ -463,6 +467,8 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
+	state->dictionary_id = DictionaryVector::CreateDictionaryId();
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -495,8 +501,26 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
 	auto result_data = FlatVector::GetData<string_t>(result);
 
-	if (!ALLOW_DICT_VECTORS || scan_count != STANDARD_VECTOR_SIZE ||
-	    start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE != 0) {
+	if (ALLOW_DICT_VECTORS && result_offset == 0 &&
+	    (scan_count != STANDARD_VECTOR_SIZE || start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE != 0)) {
+		// Emit a dictionary vector for a partial or non-aligned vector (e.g. the tail of a segment)
+		idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+		idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+		if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+			scan_state.sel_vec_size = decompress_count;
+			scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+		}
+		data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+		BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(scan_state.sel_vec->data()), src, decompress_count,
+		                                          scan_state.current_width);
+
+		// the emitted vector owns its selection, as it does not start at the beginning of the decompressed buffer
+		SelectionVector dictionary_sel(scan_count);
+		memcpy(dictionary_sel.data(), scan_state.sel_vec->data() + start_offset, scan_count * sizeof(sel_t));
+		result.Dictionary(*(scan_state.dictionary), scan_state.dictionary_size, dictionary_sel, scan_count);
+		DictionaryVector::SetDictionaryId(result, scan_state.dictionary_id);
+	} else if (!ALLOW_DICT_VECTORS || scan_count != STANDARD_VECTOR_SIZE ||
+	           start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE != 0) {
 		// Emit regular vector
 
 		// Handling non-bitpacking-group-aligned start values;
@@ -545,7 +569,8 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 
 		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+		result.Dictionary(*(scan_state.dictionary), scan_state.dictionary_size, *scan_state.sel_vec, scan_count);
+		DictionaryVector::SetDictionaryId(result, scan_state.dictionary_id);
 	}
 }
 
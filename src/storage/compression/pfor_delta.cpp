@@ -0,0 +1,628 @@
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Patched Frame-Of-Reference + Delta (PFOR-Delta)
+//===--------------------------------------------------------------------===//
+// Values are split into groups of PFOR_DELTA_GROUP_SIZE. For every group we store the deltas between consecutive
+// values, minus a frame of reference, bitpacked at a width that minimizes the total group size. Deltas that do not fit
+// in that width are "patched": their low bits are stored in the packed stream and their high bits are stored in an
+// exception list at the end of the group.
+// NULL values are encoded as a repetition of the previous value (i.e. a delta of zero), their validity is stored
+// separately by the validity column.
+//
+// Segment layout:
+// [idx_t metadata_end] [group 0] [group 1] ... [group N] [metadata N] ... [metadata 0]
+// Group layout:
+// [T base] [T frame_of_reference] [uint16_t exception_count] [uint8_t width] [uint8_t unused]
+// [bitpacked deltas] [uint16_t exception positions] [T exception high bits]
+// The metadata of each group is the uint32_t offset of the group within the segment
+
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = STANDARD_VECTOR_SIZE > 512 ? STANDARD_VECTOR_SIZE : 2048;
+static constexpr const idx_t PFOR_DELTA_HEADER_SIZE = sizeof(uint64_t);
+
+typedef uint32_t pfor_delta_metadata_t;
+
+template <class T>
+static constexpr idx_t PForDeltaGroupHeaderSize() {
+	return 2 * sizeof(T) + sizeof(uint16_t) + 2 * sizeof(uint8_t);
+}
+
+template <class T_U>
+static inline bitpacking_width_t PForDeltaRequiredWidth(T_U value) {
+	return UnsafeNumericCast<bitpacking_width_t>(64 - CountZeros<uint64_t>::Leading(static_cast<uint64_t>(value)));
+}
+
+struct EmptyPForDeltaWriter {
+	template <class T, class T_U>
+	static void WriteGroup(T base, T frame_of_reference, bitpacking_width_t width, T_U *deltas, idx_t count,
+	                       uint16_t *exception_positions, T_U *exception_values, idx_t exception_count,
+	                       void *data_ptr) {
+	}
+};
+
+template <class T, class T_S = typename MakeSigned<T>::type, class T_U = typename MakeUnsigned<T>::type>
+struct PForDeltaState {
+public:
+	PForDeltaState() : total_size(0), data_ptr(nullptr) {
+		Reset();
+	}
+
+	static constexpr const bitpacking_width_t TYPE_BITS = sizeof(T) * 8;
+
+	T values[PFOR_DELTA_GROUP_SIZE];
+	T_U deltas[PFOR_DELTA_GROUP_SIZE];
+	//! Scratch space used to select the frame of reference
+	T_S sorted_deltas[PFOR_DELTA_GROUP_SIZE];
+	uint16_t exception_positions[PFOR_DELTA_GROUP_SIZE];
+	T_U exception_values[PFOR_DELTA_GROUP_SIZE];
+	idx_t value_count;
+	idx_t total_size;
+
+	//! Used to pass the CompressionState ptr through the writer
+	void *data_ptr;
+
+	//! Min/max of the valid values in the current group (used for the zonemaps)
+	T minimum;
+	T maximum;
+	bool all_invalid;
+
+public:
+	void Reset() {
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+		all_invalid = true;
+		value_count = 0;
+	}
+
+	//! Returns the size of a group that is bitpacked with the given width and exception count
+	static idx_t GroupSize(idx_t count, bitpacking_width_t width, idx_t exception_count) {
+		return PForDeltaGroupHeaderSize<T>() + BitpackingPrimitives::GetRequiredSize(count, width) +
+		       exception_count * (sizeof(uint16_t) + sizeof(T_U)) + sizeof(pfor_delta_metadata_t);
+	}
+
+	//! Computes the width that minimizes the size of the group for the given frame of reference
+	//! Every delta that needs more bits than the chosen width becomes an exception
+	idx_t ChooseWidth(T_U frame_of_reference, bitpacking_width_t &width) {
+		idx_t width_histogram[TYPE_BITS + 1] = {0};
+		for (idx_t i = 0; i < value_count; i++) {
+			width_histogram[PForDeltaRequiredWidth<T_U>(static_cast<T_U>(deltas[i] - frame_of_reference))]++;
+		}
+
+		width = TYPE_BITS;
+		idx_t best_size = GroupSize(value_count, width, 0);
+		idx_t exception_count = 0;
+		for (idx_t w = TYPE_BITS; w > 0; w--) {
+			exception_count += width_histogram[w];
+			auto candidate = UnsafeNumericCast<bitpacking_width_t>(w - 1);
+			auto candidate_size = GroupSize(value_count, candidate, exception_count);
+			if (candidate_size < best_size) {
+				best_size = candidate_size;
+				width = candidate;
+			}
+		}
+		return best_size;
+	}
+
+	template <class OP>
+	void Flush() {
+		if (value_count == 0) {
+			return;
+		}
+		// compute the deltas, the subtraction is done on the unsigned type so that it wraps around
+		for (idx_t i = 1; i < value_count; i++) {
+			deltas[i] = static_cast<T_U>(values[i]) - static_cast<T_U>(values[i - 1]);
+			sorted_deltas[i - 1] = static_cast<T_S>(deltas[i]);
+		}
+
+		// the frame of reference is subtracted from every delta, deltas below it wrap around and become exceptions
+		// the smallest delta avoids exceptions, but a single large negative delta (e.g. a value that jumps back after
+		// an outlier) would then inflate the width of every value - so we also try a few low percentiles
+		T_S frame_of_reference = 0;
+		bitpacking_width_t width = TYPE_BITS;
+		idx_t best_size = NumericLimits<idx_t>::Maximum();
+		const idx_t delta_count = value_count - 1;
+		const idx_t candidate_ranks[] = {0, delta_count / 128, delta_count / 32, delta_count / 8};
+		for (idx_t c = 0; c < (delta_count == 0 ? 1 : 4); c++) {
+			if (c > 0 && candidate_ranks[c] == candidate_ranks[c - 1]) {
+				continue;
+			}
+			T_S candidate = 0;
+			if (delta_count > 0) {
+				auto rank = candidate_ranks[c];
+				std::nth_element(sorted_deltas, sorted_deltas + rank, sorted_deltas + delta_count);
+				candidate = sorted_deltas[rank];
+			}
+			// the first value is stored relative to the base, we pick the base so that its delta is zero
+			deltas[0] = static_cast<T_U>(candidate);
+
+			bitpacking_width_t candidate_width;
+			auto candidate_size = ChooseWidth(static_cast<T_U>(candidate), candidate_width);
+			if (candidate_size < best_size) {
+				best_size = candidate_size;
+				width = candidate_width;
+				frame_of_reference = candidate;
+			}
+		}
+		deltas[0] = static_cast<T_U>(frame_of_reference);
+		T base = static_cast<T>(static_cast<T_U>(values[0]) - static_cast<T_U>(frame_of_reference));
+
+		// subtract the frame of reference, gather the exceptions and mask out their high bits in the packed stream
+		idx_t exception_count = 0;
+		const T_U mask =
+		    width < TYPE_BITS ? static_cast<T_U>((T_U(1) << width) - T_U(1)) : NumericLimits<T_U>::Maximum();
+		for (idx_t i = 0; i < value_count; i++) {
+			deltas[i] = static_cast<T_U>(deltas[i] - static_cast<T_U>(frame_of_reference));
+			if (deltas[i] > mask) {
+				exception_positions[exception_count] = UnsafeNumericCast<uint16_t>(i);
+				exception_values[exception_count] = static_cast<T_U>(deltas[i] >> width);
+				deltas[i] &= mask;
+				exception_count++;
+			}
+		}
+
+		OP::template WriteGroup<T, T_U>(base, static_cast<T>(frame_of_reference), width, deltas, value_count,
+		                                exception_positions, exception_values, exception_count, data_ptr);
+		total_size += best_size;
+	}
+
+	template <class OP = EmptyPForDeltaWriter>
+	void Update(T value, bool is_valid) {
+		if (is_valid) {
+			values[value_count] = value;
+			minimum = MinValue<T>(minimum, value);
+			maximum = MaxValue<T>(maximum, value);
+			if (all_invalid) {
+				// replace any leading NULLs of this group with the first valid value
+				for (idx_t i = 0; i < value_count; i++) {
+					values[i] = value;
+				}
+				all_invalid = false;
+			}
+		} else {
+			// NULL values repeat the previous value, resulting in a delta of 0
+			values[value_count] = value_count == 0 ? T(0) : values[value_count - 1];
+		}
+		value_count++;
+
+		if (value_count == PFOR_DELTA_GROUP_SIZE) {
+			Flush<OP>();
+			Reset();
+		}
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	explicit PForDeltaAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	PForDeltaState<T> state;
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	// older versions cannot read PFOR-Delta segments - only use it if we do not have to be compatible with them
+	auto &config = DBConfig::GetConfig(col_data.GetDatabase());
+	if (config.options.serialization_compatibility.serialization_version < 4) {
+		return nullptr;
+	}
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<PForDeltaAnalyzeState<T>>(info);
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+
+	// A single group must always fit in a block, we are conservative here by multiplying by 2
+	auto type_size = GetTypeIdSize(input.GetType().InternalType());
+	if (type_size * PFOR_DELTA_GROUP_SIZE * 2 > state.info.GetBlockSize()) {
+		return false;
+	}
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.state.Update(data[idx], vdata.validity.RowIsValid(idx));
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+	analyze_state.state.template Flush<EmptyPForDeltaWriter>();
+	return analyze_state.state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T, bool WRITE_STATISTICS>
+struct PForDeltaCompressState : public CompressionState {
+public:
+	PForDeltaCompressState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		state.data_ptr = reinterpret_cast<void *>(this);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! Ptr to the next free spot in the segment
+	data_ptr_t data_ptr;
+	//! Ptr to the next free spot for storing the group offsets (growing downwards)
+	data_ptr_t metadata_ptr;
+
+	PForDeltaState<T> state;
+
+public:
+	struct PForDeltaWriter {
+		template <class T_IN, class T_U>
+		static void WriteGroup(T_IN base, T_IN frame_of_reference, bitpacking_width_t width, T_U *deltas, idx_t count,
+		                       uint16_t *exception_positions, T_U *exception_values, idx_t exception_count,
+		                       void *data_ptr) {
+			auto compress_state = reinterpret_cast<PForDeltaCompressState<T, WRITE_STATISTICS> *>(data_ptr);
+			compress_state->WriteGroup(base, frame_of_reference, width, deltas, count, exception_positions,
+			                           exception_values, exception_count);
+		}
+	};
+
+	template <class T_U>
+	void WriteGroup(T base, T frame_of_reference, bitpacking_width_t width, T_U *deltas, idx_t count,
+	                uint16_t *exception_positions, T_U *exception_values, idx_t exception_count) {
+		auto packed_size = BitpackingPrimitives::GetRequiredSize(count, width);
+		auto data_bytes =
+		    PForDeltaGroupHeaderSize<T>() + packed_size + exception_count * (sizeof(uint16_t) + sizeof(T_U));
+		FlushAndCreateSegmentIfFull(data_bytes);
+
+		// write the offset of this group to the metadata
+		metadata_ptr -= sizeof(pfor_delta_metadata_t);
+		Store<pfor_delta_metadata_t>(UnsafeNumericCast<pfor_delta_metadata_t>(data_ptr - handle.Ptr()), metadata_ptr);
+
+		// write the group header
+		Store<T>(base, data_ptr);
+		data_ptr += sizeof(T);
+		Store<T>(frame_of_reference, data_ptr);
+		data_ptr += sizeof(T);
+		Store<uint16_t>(UnsafeNumericCast<uint16_t>(exception_count), data_ptr);
+		data_ptr += sizeof(uint16_t);
+		Store<uint8_t>(width, data_ptr);
+		data_ptr += 2 * sizeof(uint8_t);
+
+		// write the packed deltas, followed by the exceptions
+		BitpackingPrimitives::PackBuffer<T_U, false>(data_ptr, deltas, count, width);
+		data_ptr += packed_size;
+		memcpy(data_ptr, exception_positions, exception_count * sizeof(uint16_t));
+		data_ptr += exception_count * sizeof(uint16_t);
+		memcpy(data_ptr, exception_values, exception_count * sizeof(T_U));
+		data_ptr += exception_count * sizeof(T_U);
+
+		current_segment->count += count;
+		if (WRITE_STATISTICS && !state.all_invalid) {
+			current_segment->stats.statistics.template UpdateNumericStats<T>(state.minimum);
+			current_segment->stats.statistics.template UpdateNumericStats<T>(state.maximum);
+		}
+	}
+
+	bool CanStore(idx_t data_bytes) {
+		auto required_data_bytes = AlignValue<idx_t>(NumericCast<idx_t>(data_ptr - handle.Ptr()) + data_bytes);
+		auto required_meta_bytes =
+		    NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) + sizeof(pfor_delta_metadata_t);
+		return required_data_bytes + required_meta_bytes <= info.GetBlockSize();
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + PFOR_DELTA_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.template Update<PForDeltaWriter>(data[idx], vdata.validity.RowIsValid(idx));
+		}
+	}
+
+	void FlushAndCreateSegmentIfFull(idx_t required_data_bytes) {
+		if (!CanStore(required_data_bytes)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		D_ASSERT(CanStore(required_data_bytes));
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the metadata next to the data
+		auto unaligned_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		auto metadata_offset = AlignValue(unaligned_offset);
+		auto metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		auto total_segment_size = metadata_offset + metadata_size;
+
+		if (unaligned_offset != metadata_offset) {
+			// zero initialize any padding bits
+			memset(base_ptr + unaligned_offset, 0, metadata_offset - unaligned_offset);
+		}
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+
+		// store the offset to the end of the metadata (the metadata of the first group)
+		Store<idx_t>(total_segment_size, base_ptr);
+		handle.Destroy();
+
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		state.template Flush<PForDeltaWriter>();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T, bool WRITE_STATISTICS>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T, WRITE_STATISTICS>>(checkpointer, state->info);
+}
+
+template <class T, bool WRITE_STATISTICS>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T, WRITE_STATISTICS>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T, bool WRITE_STATISTICS>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T, WRITE_STATISTICS>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+struct PForDeltaScanState : public SegmentScanState {
+public:
+	explicit PForDeltaScanState(ColumnSegment &segment) : current_segment(segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+
+		segment_ptr = handle.Ptr() + segment.GetBlockOffset();
+		metadata_end = segment_ptr + Load<idx_t>(segment_ptr);
+		segment_count = segment.count;
+		current_group_count = MinValue<idx_t>(segment_count, PFOR_DELTA_GROUP_SIZE);
+	}
+
+	BufferHandle handle;
+	ColumnSegment &current_segment;
+	//! Ptr to the start of the segment, the group offsets in the metadata are relative to it
+	data_ptr_t segment_ptr;
+	//! Ptr to the end of the metadata (i.e. the metadata of the first group is right before it)
+	data_ptr_t metadata_end;
+	idx_t segment_count;
+
+	//! The decoded values of the current group
+	T_U decompression_buffer[PFOR_DELTA_GROUP_SIZE];
+	idx_t current_group_idx = 0;
+	idx_t current_group_offset = 0;
+	idx_t current_group_count;
+	bool current_group_decoded = false;
+
+public:
+	//! Decode the current group into the decompression buffer
+	void DecodeGroup() {
+		D_ASSERT(!current_group_decoded);
+		auto metadata_ptr = metadata_end - (current_group_idx + 1) * sizeof(pfor_delta_metadata_t);
+		auto group_ptr = segment_ptr + Load<pfor_delta_metadata_t>(metadata_ptr);
+
+		auto base = static_cast<T_U>(Load<T>(group_ptr));
+		group_ptr += sizeof(T);
+		auto frame_of_reference = static_cast<T_U>(Load<T>(group_ptr));
+		group_ptr += sizeof(T);
+		auto exception_count = Load<uint16_t>(group_ptr);
+		group_ptr += sizeof(uint16_t);
+		auto width = Load<uint8_t>(group_ptr);
+		group_ptr += 2 * sizeof(uint8_t);
+
+		// unpack the deltas
+		auto packed_size = BitpackingPrimitives::GetRequiredSize(current_group_count, width);
+		for (idx_t i = 0; i < current_group_count; i += BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE) {
+			BitpackingPrimitives::UnPackBlock<T_U>(data_ptr_cast(decompression_buffer + i),
+			                                       group_ptr + (i * width) / 8, width);
+		}
+		group_ptr += packed_size;
+
+		// patch the exceptions
+		auto exception_positions = group_ptr;
+		auto exception_values = group_ptr + exception_count * sizeof(uint16_t);
+		for (idx_t i = 0; i < exception_count; i++) {
+			auto position = Load<uint16_t>(exception_positions + i * sizeof(uint16_t));
+			auto high_bits = Load<T_U>(exception_values + i * sizeof(T_U));
+			decompression_buffer[position] |= static_cast<T_U>(high_bits << width);
+		}
+
+		// apply the frame of reference and compute the prefix sum, both with wrapping unsigned arithmetic
+		T_U previous = base;
+		for (idx_t i = 0; i < current_group_count; i++) {
+			previous += static_cast<T_U>(decompression_buffer[i] + frame_of_reference);
+			decompression_buffer[i] = previous;
+		}
+		current_group_decoded = true;
+	}
+
+	void NextGroup() {
+		current_group_idx++;
+		current_group_offset = 0;
+		current_group_decoded = false;
+		current_group_count = MinValue<idx_t>(segment_count - current_group_idx * PFOR_DELTA_GROUP_SIZE,
+		                                      PFOR_DELTA_GROUP_SIZE);
+	}
+
+	void Skip(idx_t skip_count) {
+		auto target = current_group_idx * PFOR_DELTA_GROUP_SIZE + current_group_offset + skip_count;
+		auto target_group = target / PFOR_DELTA_GROUP_SIZE;
+		if (target_group != current_group_idx) {
+			// skipping to a different group - we don't need to decode any of the groups we skip over
+			current_group_idx = target_group - 1;
+			NextGroup();
+		}
+		current_group_offset = target % PFOR_DELTA_GROUP_SIZE;
+	}
+
+	void Scan(T *result_data, idx_t scan_count) {
+		idx_t scanned = 0;
+		while (scanned < scan_count) {
+			if (current_group_offset == current_group_count) {
+				NextGroup();
+			}
+			if (!current_group_decoded) {
+				DecodeGroup();
+			}
+			auto to_scan = MinValue<idx_t>(scan_count - scanned, current_group_count - current_group_offset);
+			memcpy(result_data + scanned, decompression_buffer + current_group_offset, to_scan * sizeof(T));
+			scanned += to_scan;
+			current_group_offset += to_scan;
+		}
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	auto result = make_uniq<PForDeltaScanState<T>>(segment);
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	scan_state.Scan(result_data + result_offset, scan_count);
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	PForDeltaScanState<T> scan_state(segment);
+	scan_state.Skip(NumericCast<idx_t>(row_id));
+
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.Scan(result_data + result_idx, 1);
+}
+
+template <class T>
+void PForDeltaSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	scan_state.Skip(skip_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T, bool WRITE_STATISTICS = true>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                           PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>,
+	                           PForDeltaInitCompression<T, WRITE_STATISTICS>, PForDeltaCompress<T, WRITE_STATISTICS>,
+	                           PForDeltaFinalizeCompress<T, WRITE_STATISTICS>, PForDeltaInitScan<T>, PForDeltaScan<T>,
+	                           PForDeltaScanPartial<T>, PForDeltaFetchRow<T>, PForDeltaSkip<T>);
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return GetPForDeltaFunction<int8_t>(type);
+	case PhysicalType::INT16:
+		return GetPForDeltaFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT8:
+		return GetPForDeltaFunction<uint8_t>(type);
+	case PhysicalType::UINT16:
+		return GetPForDeltaFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	case PhysicalType::LIST:
+		return GetPForDeltaFunction<uint64_t, false>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR-Delta");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(const PhysicalType physical_type) {
+	switch (physical_type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::LIST:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -530,8 +530,28 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	// read the buffer from disk
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
+	VerifyBlocks(buffer, start_block, block_count);
+}
+
+void SingleFileBlockManager::ReadBlockBatch(vector<BlockReadRange> &ranges) {
+	vector<FileReadRequest> requests;
+	requests.reserve(ranges.size());
+	for (auto &range : ranges) {
+		D_ASSERT(range.start_block >= 0);
+		D_ASSERT(range.block_count >= 1);
+		auto location = GetBlockLocation(range.start_block);
+		requests.emplace_back(range.buffer.InternalBuffer(), range.buffer.AllocSize(), location);
+	}
+	// read all ranges from disk at once
+	handle->ReadBatch(requests);
+	for (auto &range : ranges) {
+		VerifyBlocks(range.buffer, range.start_block, range.block_count);
+	}
+}
 
+void SingleFileBlockManager::VerifyBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	// for each of the blocks - verify the checksum
+	auto location = GetBlockLocation(start_block);
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
 		// compute the checksum
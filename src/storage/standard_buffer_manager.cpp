@@ -210,94 +210,181 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-                                      block_id_t first_block, block_id_t last_block) {
-	auto &block_manager = handles[0]->block_manager;
-	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
+                                      const vector<pair<block_id_t, block_id_t>> &block_ranges,
+                                      bool read_single_blocks) {
+	auto &block_manager = handles[load_map.begin()->second]->block_manager;
+	// allocate a buffer to hold the data of each range of blocks, and read all of the ranges at once
+	vector<BufferHandle> intermediate_buffers;
+	vector<BlockReadRange> read_ranges;
+	intermediate_buffers.reserve(block_ranges.size());
+	for (auto &block_range : block_ranges) {
+		idx_t block_count = NumericCast<idx_t>(block_range.second - block_range.first + 1);
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
-	if (block_count == 1) {
-		// prefetching with block_count == 1 has no performance impact since we can't batch reads
-		// skip the prefetch in this case
-		// we do it anyway if alternative_verify is on for extra testing
+		if (block_count == 1 && !read_single_blocks) {
+			// prefetching with block_count == 1 has no performance impact since we can't batch reads
+			// skip the prefetch in this case, unless the block is read ahead in the background (see BlockPrefetcher)
+			// we do it anyway if alternative_verify is on for extra testing
+			continue;
+		}
+#endif
+		intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize()));
+		read_ranges.emplace_back(intermediate_buffers.back().GetFileBuffer(), block_range.first, block_count);
+	}
+	if (read_ranges.empty()) {
 		return;
 	}
-#endif
-
-	// allocate a buffer to hold the data of all of the blocks
-	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
-	// perform a batch read of the blocks into the buffer
-	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+	block_manager.ReadBlockBatch(read_ranges);
 
 	// the blocks are read - now we need to assign them to the individual blocks
-	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
-		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
-		auto entry = load_map.find(block_id);
-		D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
-		auto &handle = handles[entry->second];
-
-		// reserve memory for the block
-		idx_t required_memory = handle->memory_usage;
-		unique_ptr<FileBuffer> reusable_buffer;
-		auto reservation =
-		    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
-		                       StringUtil::BytesToHumanReadableString(required_memory));
-		// now load the block from the buffer
-		// note that we discard the buffer handle - we do not keep it around
-		// the prefetching relies on the block handle being pinned again during the actual read before it is evicted
-		BufferHandle buf;
-		{
-			lock_guard<mutex> lock(handle->lock);
-			if (handle->state == BlockState::BLOCK_LOADED) {
-				// the block is loaded already by another thread - free up the reservation and continue
-				reservation.Resize(0);
-				continue;
+	for (idx_t range_idx = 0; range_idx < read_ranges.size(); range_idx++) {
+		auto &read_range = read_ranges[range_idx];
+		for (idx_t block_idx = 0; block_idx < read_range.block_count; block_idx++) {
+			block_id_t block_id = read_range.start_block + NumericCast<block_id_t>(block_idx);
+			auto entry = load_map.find(block_id);
+			D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
+			auto &handle = handles[entry->second];
+
+			// reserve memory for the block
+			idx_t required_memory = handle->memory_usage;
+			unique_ptr<FileBuffer> reusable_buffer;
+			auto reservation =
+			    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
+			                       StringUtil::BytesToHumanReadableString(required_memory));
+			// now load the block from the buffer
+			// note that we discard the buffer handle - we do not keep it around
+			// the prefetching relies on the block handle being pinned again during the actual read before eviction
+			BufferHandle buf;
+			{
+				lock_guard<mutex> lock(handle->lock);
+				if (handle->state == BlockState::BLOCK_LOADED) {
+					// the block is loaded already by another thread - free up the reservation and continue
+					reservation.Resize(0);
+					continue;
+				}
+				auto block_ptr = read_range.buffer.InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
+				buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
+				handle->readers = 1;
+				handle->prefetched = true;
+				handle->memory_charge = std::move(reservation);
 			}
-			auto block_ptr =
-			    intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
-			buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
-			handle->readers = 1;
-			handle->memory_charge = std::move(reservation);
 		}
 	}
 }
 
+void StandardBufferManager::BatchReadTemporary(vector<shared_ptr<BlockHandle>> &handles) {
+	if (!temporary_directory.handle) {
+		return;
+	}
+	// reserve memory for the blocks before locking them, as evicting blocks requires locking (other) block handles
+	// prefetching is best-effort: if we cannot make room for a block, we stop reading ahead instead of throwing
+	vector<TempBufferPoolReservation> reservations;
+	vector<unique_ptr<FileBuffer>> reusable_buffers;
+	for (auto &handle : handles) {
+		unique_ptr<FileBuffer> reusable_buffer;
+		auto result = buffer_pool.EvictBlocks(handle->tag, handle->memory_usage, buffer_pool.maximum_memory,
+		                                      &reusable_buffer);
+		if (!result.success) {
+			break;
+		}
+		reservations.push_back(std::move(result.reservation));
+		reusable_buffers.push_back(std::move(reusable_buffer));
+	}
+	handles.resize(reservations.size());
+
+	// the buffer handles are declared before the locks: they must be destroyed (unpinned) after unlocking
+	vector<BufferHandle> loaded_buffers;
+	vector<unique_lock<mutex>> locks;
+	vector<idx_t> to_be_loaded;
+	vector<block_id_t> block_ids;
+	vector<unique_ptr<FileBuffer>> to_be_loaded_buffers;
+	auto &temp_file = temporary_directory.handle->GetTempFile();
+	for (idx_t i = 0; i < handles.size(); i++) {
+		// we only try to lock the blocks: as we never wait for a lock, we can safely hold the locks of several blocks
+		auto &handle = handles[i];
+		unique_lock<mutex> lock(handle->lock, std::try_to_lock);
+		if (!lock.owns_lock() || handle->state == BlockState::BLOCK_LOADED ||
+		    !temp_file.HasTemporaryBuffer(handle->block_id)) {
+			// the block is being loaded or evicted by another thread - free up the reservation
+			reservations[i].Resize(0);
+			continue;
+		}
+		locks.push_back(std::move(lock));
+		to_be_loaded.push_back(i);
+		block_ids.push_back(handle->block_id);
+		to_be_loaded_buffers.push_back(std::move(reusable_buffers[i]));
+	}
+	if (to_be_loaded.empty()) {
+		return;
+	}
+
+	auto buffers = temp_file.ReadTemporaryBuffers(block_ids, to_be_loaded_buffers);
+	for (idx_t i = 0; i < to_be_loaded.size(); i++) {
+		// note that we discard the buffer handles - the blocks should be pinned again before they are evicted
+		auto &handle = handles[to_be_loaded[i]];
+		evicted_data_per_tag[uint8_t(handle->tag)] -= GetBlockSize();
+		handle->buffer = std::move(buffers[i]);
+		handle->state = BlockState::BLOCK_LOADED;
+		handle->readers = 1;
+		handle->prefetched = true;
+		handle->memory_charge = std::move(reservations[to_be_loaded[i]]);
+		loaded_buffers.emplace_back(handle, handle->buffer.get());
+	}
+	locks.clear();
+}
+
 void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	LoadBlocks(handles, false);
+}
+
+void StandardBufferManager::ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	LoadBlocks(handles, true);
+}
+
+void StandardBufferManager::LoadBlocks(vector<shared_ptr<BlockHandle>> &handles, bool read_single_blocks) {
 	// figure out which set of blocks we should load
 	map<block_id_t, idx_t> to_be_loaded;
+	vector<shared_ptr<BlockHandle>> temporary_handles;
 	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
 		auto &handle = handles[block_idx];
 		lock_guard<mutex> lock(handle->lock);
-		if (handle->state != BlockState::BLOCK_LOADED) {
+		if (handle->state == BlockState::BLOCK_LOADED) {
+			continue;
+		}
+		if (handle->BlockId() < MAXIMUM_BLOCK) {
 			// need to load this block - add it to the map
 			to_be_loaded.insert(make_pair(handle->BlockId(), block_idx));
+		} else if (handle->MustWriteToTemporaryFile() && handle->memory_usage == GetBlockAllocSize()) {
+			// the block was written to one of the (shared) temporary files
+			temporary_handles.push_back(handle);
 		}
 	}
+	if (!temporary_handles.empty()) {
+		BatchReadTemporary(temporary_handles);
+	}
 	if (to_be_loaded.empty()) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
-	block_id_t first_block = -1;
-	block_id_t previous_block_id = -1;
+	// group adjacent blocks into ranges, and read the ranges in batches
+	vector<pair<block_id_t, block_id_t>> block_ranges;
+	idx_t batch_block_count = 0;
 	for (auto &entry : to_be_loaded) {
-		if (previous_block_id < 0) {
-			// this the first block we are seeing
-			first_block = entry.first;
-			previous_block_id = first_block;
-		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
-			previous_block_id = entry.first;
+		if (!block_ranges.empty() && block_ranges.back().second + 1 == entry.first) {
+			// this block is adjacent to the previous block - add it to the range
+			block_ranges.back().second = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
-
-			// set the first_block and previous_block_id to the current block
-			first_block = entry.first;
-			previous_block_id = entry.first;
+			// this block is not adjacent to the previous block - start a new range
+			if (batch_block_count >= MAX_BATCH_READ_BLOCKS) {
+				BatchRead(handles, to_be_loaded, block_ranges, read_single_blocks);
+				block_ranges.clear();
+				batch_block_count = 0;
+			}
+			block_ranges.emplace_back(entry.first, entry.first);
 		}
+		batch_block_count++;
 	}
 	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	BatchRead(handles, to_be_loaded, block_ranges, read_single_blocks);
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -313,6 +400,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			buffer_pool.RegisterPin(*handle, true);
 			handle->readers++;
 			buf = handle->Load(handle);
 		}
@@ -333,12 +421,14 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			buffer_pool.RegisterPin(*handle, true);
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load(handle);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
+			buffer_pool.RegisterPin(*handle, false);
 			buf = handle->Load(handle, std::move(reusable_buffer));
 			handle->readers = 1;
 			handle->memory_charge = std::move(reservation);
@@ -423,6 +513,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage.GetUsedMemory(MemoryTag(k), BufferPool::MemoryUsageCaches::FLUSH);
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.GetBufferHits(MemoryTag(k));
+		info.buffer_misses = buffer_pool.GetBufferMisses(MemoryTag(k));
 		result.push_back(info);
 	}
 	return result;
@@ -569,6 +661,10 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		// these files hold a single (uncompressed) block of a non-standard size
+		info.block_size = info.size;
+		info.block_count = 1;
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
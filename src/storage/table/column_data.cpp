@@ -2,6 +2,7 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -24,7 +25,7 @@ namespace duckdb {
 ColumnData::ColumnData(BlockManager &block_manager, DataTableInfo &info, idx_t column_index, idx_t start_row,
                        LogicalType type_p, optional_ptr<ColumnData> parent)
     : start(start_row), count(0), block_manager(block_manager), info(info), column_index(column_index),
-      type(std::move(type_p)), parent(parent), allocation_size(0) {
+      type(std::move(type_p)), parent(parent), has_vector_stats(false), allocation_size(0) {
 	if (!parent) {
 		stats = make_uniq<SegmentStatistics>(type);
 	}
@@ -138,6 +139,11 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
 	}
 	state.previous_states.clear();
+	if (state.initialized && state.scan_block.get() != state.current->block.get()) {
+		// the segment moved to a different block since we initialized its scan, e.g., because the partial block holding
+		// optimistically written data was flushed to disk - the scan state might refer to the old block
+		state.initialized = false;
+	}
 	if (!state.initialized) {
 		D_ASSERT(state.current);
 		state.current->InitializeScan(state);
@@ -298,9 +304,50 @@ idx_t ColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t scan_c
 	return ScanVector(state, result, scan_count, ScanVectorType::SCAN_FLAT_VECTOR);
 }
 
+static bool DictionaryFilterSelection(Vector &result, SelectionVector &sel, idx_t &s_count,
+                                      const TableFilter &filter) {
+	auto dictionary_size = DictionaryVector::DictionarySize(result);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= s_count) {
+		return false;
+	}
+	// evaluate the filter once for every entry of the dictionary
+	auto &dictionary = DictionaryVector::Child(result);
+	auto dictionary_count = dictionary_size.GetIndex();
+	SelectionVector dictionary_sel;
+	dictionary_sel.Initialize(nullptr);
+	idx_t approved_dictionary_count = dictionary_count;
+	UnifiedVectorFormat dictionary_data;
+	dictionary.ToUnifiedFormat(dictionary_count, dictionary_data);
+	ColumnSegment::FilterSelection(dictionary_sel, dictionary, dictionary_data, filter, dictionary_count,
+	                               approved_dictionary_count);
+
+	auto matches = make_unsafe_uniq_array<bool>(dictionary_count);
+	memset(matches.get(), 0, dictionary_count * sizeof(bool));
+	for (idx_t i = 0; i < approved_dictionary_count; i++) {
+		matches[dictionary_sel.get_index(i)] = true;
+	}
+
+	// now select the rows that reference one of the matching entries
+	auto &offsets = DictionaryVector::SelVector(result);
+	SelectionVector result_sel(s_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < s_count; i++) {
+		auto idx = sel.get_index(i);
+		result_sel.set_index(result_count, idx);
+		result_count += matches[offsets.get_index(idx)];
+	}
+	sel.Initialize(result_sel);
+	s_count = result_count;
+	return true;
+}
+
 void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                         SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
 	idx_t scan_count = Scan(transaction, vector_index, state, result);
+	if (result.GetVectorType() == VectorType::DICTIONARY_VECTOR &&
+	    DictionaryFilterSelection(result, sel, s_count, filter)) {
+		return;
+	}
 
 	UnifiedVectorFormat vdata;
 	result.ToUnifiedFormat(scan_count, vdata);
@@ -367,6 +414,39 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+FilterPropagateResult ColumnData::CheckVectorZonemap(idx_t vector_index, TableFilter &filter) {
+	if (!has_vector_stats || !DBConfig::GetConfig(GetDatabase()).options.enable_vector_zonemaps) {
+		// the column has no per-vector statistics (or they are disabled) - avoid taking the lock for every vector
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	{
+		lock_guard<mutex> l(stats_lock);
+		if (vector_index >= vector_stats.size()) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		auto prune_result = filter.CheckStatistics(vector_stats[vector_index]);
+		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	lock_guard<mutex> l(update_lock);
+	if (updates && filter.CheckStatistics(*updates->GetStatistics()) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		// updated values might match the filter
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+vector<BaseStatistics> ColumnData::GetVectorStatistics() const {
+	lock_guard<mutex> l(stats_lock);
+	vector<BaseStatistics> result;
+	result.reserve(vector_stats.size());
+	for (auto &vector_stat : vector_stats) {
+		result.push_back(vector_stat.Copy());
+	}
+	return result;
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
@@ -576,6 +656,14 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Co
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
 	ClearUpdates();
+	{
+		lock_guard<mutex> stats_guard(stats_lock);
+		vector_stats.clear();
+		for (auto &vector_stat : checkpoint_state->vector_stats) {
+			vector_stats.push_back(vector_stat.Copy());
+		}
+		has_vector_stats = !vector_stats.empty();
+	}
 
 	return checkpoint_state;
 }
@@ -605,6 +693,9 @@ void ColumnData::InitializeColumn(PersistentColumnData &column_data, BaseStatist
 
 		data.AppendSegment(std::move(segment));
 	}
+	lock_guard<mutex> l(stats_lock);
+	vector_stats = std::move(column_data.vector_stats);
+	has_vector_stats = !vector_stats.empty();
 }
 
 bool ColumnData::IsPersistent() {
@@ -653,6 +744,9 @@ void PersistentColumnData::Serialize(Serializer &serializer) const {
 		serializer.WriteList(102, "sub_columns", child_columns.size() - 1,
 		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(child_columns[i + 1]); });
 	}
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault(103, "vector_stats", vector_stats);
+	}
 }
 
 void PersistentColumnData::DeserializeField(Deserializer &deserializer, field_id_t field_idx, const char *field_name,
@@ -691,6 +785,7 @@ PersistentColumnData PersistentColumnData::Deserialize(Deserializer &deserialize
 	default:
 		break;
 	}
+	deserializer.ReadPropertyWithDefault(103, "vector_stats", result.vector_stats);
 	return result;
 }
 
@@ -759,6 +854,7 @@ bool PersistentCollectionData::HasUpdates() const {
 
 PersistentColumnData ColumnData::Serialize() {
 	PersistentColumnData result(type.InternalType(), GetDataPointers());
+	result.vector_stats = GetVectorStatistics();
 	result.has_updates = HasUpdates();
 	return result;
 }
@@ -62,6 +62,108 @@ void ColumnDataCheckpointer::ScanSegments(const std::function<void(Vector &, idx
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Vector Statistics
+//===--------------------------------------------------------------------===//
+static bool SupportsVectorStatistics(const LogicalType &type) {
+	if (BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS) {
+		return false;
+	}
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateVectorStatistics(vector<BaseStatistics> &vector_stats, const LogicalType &type,
+                                            Vector &input, idx_t row_offset, idx_t count) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	idx_t offset = 0;
+	while (offset < count) {
+		// the input is not necessarily aligned to vectors of the row group - update the stats vector by vector
+		idx_t row_idx = row_offset + offset;
+		idx_t vector_idx = row_idx / STANDARD_VECTOR_SIZE;
+		idx_t end = MinValue<idx_t>(count, offset + STANDARD_VECTOR_SIZE - row_idx % STANDARD_VECTOR_SIZE);
+		while (vector_stats.size() <= vector_idx) {
+			vector_stats.push_back(BaseStatistics::CreateEmpty(type));
+		}
+		auto &stats = vector_stats[vector_idx];
+		for (; offset < end; offset++) {
+			auto idx = vdata.sel->get_index(offset);
+			if (!vdata.validity.RowIsValid(idx)) {
+				stats.SetHasNull();
+				continue;
+			}
+			stats.SetHasNoNull();
+			stats.UpdateNumericStats<T>(data[idx]);
+		}
+	}
+}
+
+static void UpdateVectorStatistics(vector<BaseStatistics> &vector_stats, const LogicalType &type, Vector &input,
+                                   idx_t row_offset, idx_t count) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+		TemplatedUpdateVectorStatistics<bool>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::INT8:
+		TemplatedUpdateVectorStatistics<int8_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateVectorStatistics<int16_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateVectorStatistics<int32_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateVectorStatistics<int64_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateVectorStatistics<hugeint_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateVectorStatistics<uint8_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateVectorStatistics<uint16_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateVectorStatistics<uint32_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateVectorStatistics<uint64_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateVectorStatistics<uhugeint_t>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedUpdateVectorStatistics<float>(vector_stats, type, input, row_offset, count);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedUpdateVectorStatistics<double>(vector_stats, type, input, row_offset, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for UpdateVectorStatistics");
+	}
+}
+
 CompressionType ForceCompression(vector<optional_ptr<CompressionFunction>> &compression_functions,
                                  CompressionType compression_type) {
 // On of the force_compression flags has been set
@@ -198,9 +300,25 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	bool write_vector_stats = config.options.enable_vector_zonemaps && SupportsVectorStatistics(GetType());
+	idx_t row_offset = 0;
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (write_vector_stats) {
+			UpdateVectorStatistics(state.vector_stats, GetType(), scan_vector, row_offset, count);
+			row_offset += count;
+		}
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
+	if (write_vector_stats) {
+		// only full vectors keep their statistics - the last vector can still be appended to
+		idx_t full_vectors = row_offset / STANDARD_VECTOR_SIZE;
+		if (state.vector_stats.size() > full_vectors) {
+			state.vector_stats.erase(state.vector_stats.begin() + NumericCast<int64_t>(full_vectors),
+			                         state.vector_stats.end());
+		}
+	}
 
 	nodes.clear();
 }
@@ -238,6 +356,11 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 
 		state.data_pointers.push_back(std::move(pointer));
 	}
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	if (config.options.enable_vector_zonemaps) {
+		// the data is unchanged - keep the vector statistics that were stored for it
+		state.vector_stats = col_data.GetVectorStatistics();
+	}
 }
 
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
@@ -245,6 +245,27 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	return true;
 }
 
+void RowGroup::InitializePrefetch(PrefetchState &prefetch_state, CollectionScanState &state) {
+	auto &column_ids = state.GetColumnIds();
+	// check the zonemaps without labeling filters as always true: the filter state belongs to the current row group
+	for (auto &entry : state.GetFilterInfo().GetFilterList()) {
+		auto prune_result = GetColumn(entry.table_column_index).CheckZonemap(entry.filter);
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return;
+		}
+	}
+	for (auto &column : column_ids) {
+		if (column == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto &column_data = GetColumn(column);
+		ColumnScanState column_state;
+		column_state.Initialize(column_data.type, nullptr);
+		column_data.InitializeScan(column_state);
+		column_data.InitializePrefetch(prefetch_state, column_state, count);
+	}
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -419,6 +440,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -437,8 +460,14 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		auto base_column_idx = entry.table_column_index;
 		auto &filter = entry.filter;
 
-		auto prune_result = GetColumn(base_column_idx).CheckZonemap(state.column_scans[column_idx], filter);
+		auto &column = GetColumn(base_column_idx);
+		auto prune_result = column.CheckZonemap(state.column_scans[column_idx], filter);
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			// we cannot skip the rest of the segment - check if we can skip the current vector
+			if (column.CheckVectorZonemap(state.vector_index, filter) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				NextVector(state);
+				return false;
+			}
 			continue;
 		}
 		idx_t target_row = GetFilterScanCount(state.column_scans[column_idx], filter);
@@ -961,6 +990,9 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
+	SerializationOptions serialization_options;
+	auto &config = DBConfig::GetConfig(GetCollection().GetAttached().GetDatabase());
+	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
@@ -974,7 +1006,7 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		// Just as above, the state can refer to many other states, so this
 		// can cascade recursively into more pointer writes.
 		auto persistent_data = state->ToPersistentData();
-		BinarySerializer serializer(data_writer);
+		BinarySerializer serializer(data_writer, serialization_options);
 		serializer.Begin();
 		persistent_data.Serialize(serializer);
 		serializer.End();
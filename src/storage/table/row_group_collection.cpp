@@ -7,6 +7,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
+#include "duckdb/storage/buffer/block_prefetcher.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
@@ -181,6 +182,7 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.prefetch_row_group = state.current_row_group;
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
@@ -190,6 +192,7 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		idx_t max_row;
 		RowGroupCollection *collection;
 		RowGroup *row_group;
+		vector<reference<RowGroup>> prefetch_row_groups;
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
@@ -218,10 +221,36 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
+
+			// select the row groups after this one that should be prefetched
+			auto prefetch_depth = ClientConfig::GetConfig(context).scan_prefetch_depth;
+			if (prefetch_depth > 0 && !block_manager.InMemory()) {
+				auto prefetch_end = prefetch_depth > NumericLimits<idx_t>::Maximum() - row_group->index
+				                        ? NumericLimits<idx_t>::Maximum()
+				                        : row_group->index + prefetch_depth;
+				while (state.prefetch_row_group && state.prefetch_row_group->index <= prefetch_end) {
+					if (state.prefetch_row_group->index > row_group->index) {
+						prefetch_row_groups.push_back(*state.prefetch_row_group);
+					}
+					state.prefetch_row_group = row_groups->GetNextSegment(state.prefetch_row_group);
+				}
+				if (!prefetch_row_groups.empty() && !state.prefetcher) {
+					state.prefetcher = make_uniq<BlockPrefetcher>(context, block_manager.buffer_manager);
+				}
+			}
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
 
+		// schedule the blocks of the upcoming row groups to be loaded in the background
+		if (!prefetch_row_groups.empty()) {
+			PrefetchState prefetch_state;
+			for (auto &prefetch_row_group : prefetch_row_groups) {
+				prefetch_row_group.get().InitializePrefetch(prefetch_state, scan_state);
+			}
+			state.prefetcher->Prefetch(std::move(prefetch_state.blocks));
+		}
+
 		// initialize the scan for this row group
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
 		if (!need_to_scan) {
@@ -746,6 +775,8 @@ struct VacuumState {
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! Row groups that store data at or after this block id are rewritten (if set)
+	optional_idx defragment_boundary;
 };
 
 class VacuumTask : public BaseCheckpointTask {
@@ -871,6 +902,7 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	state.defragment_boundary = checkpoint_state.writer.GetDefragmentBoundary();
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
@@ -885,6 +917,17 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 	}
 }
 
+static bool RowGroupUsesBlocksFrom(RowGroup &row_group, block_id_t boundary) {
+	vector<ColumnSegmentInfo> segment_info;
+	row_group.GetColumnSegmentInfo(0, segment_info);
+	for (auto &info : segment_info) {
+		if (info.persistent && info.block_id >= boundary) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                              idx_t segment_idx) {
 	static constexpr const idx_t MAX_MERGE_COUNT = 3;
@@ -937,7 +980,27 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		// we cannot reduce the amount of row groups - check if this row group has enough deletes to rewrite it
+		auto &row_group = *checkpoint_state.segments[segment_idx].node;
+		idx_t total_rows = row_group.count;
+		idx_t deleted_rows = total_rows - state.row_group_counts[segment_idx];
+		auto &config = DBConfig::GetConfig(checkpoint_state.writer.GetDatabase());
+		auto rewrite_threshold = config.options.vacuum_rewrite_threshold;
+		bool rewrite = rewrite_threshold > 0 && deleted_rows > 0 &&
+		               double(deleted_rows) >= rewrite_threshold * double(total_rows);
+		if (!rewrite && state.defragment_boundary.IsValid()) {
+			// when defragmenting we also rewrite row groups stored in the tail of the file
+			auto boundary = NumericCast<block_id_t>(state.defragment_boundary.GetIndex());
+			rewrite = RowGroupUsesBlocksFrom(row_group, boundary);
+		}
+		if (!rewrite) {
+			return false;
+		}
+		// rewrite the row group by itself, dropping the deleted rows and the blocks they occupy
+		merge_count = 1;
+		target_count = 1;
+		merge_rows = state.row_group_counts[segment_idx];
+		next_idx = segment_idx + 1;
 	}
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
@@ -970,7 +1033,10 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	auto &config = DBConfig::GetConfig(writer.GetDatabase());
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
-		if (total_vacuum_tasks < config.options.max_vacuum_tasks) {
+		// when defragmenting every row group might need to be relocated - don't limit the amount of vacuum tasks
+		// row groups that are merged by an already scheduled vacuum task must be skipped even if we hit the limit
+		if (total_vacuum_tasks < config.options.max_vacuum_tasks || vacuum_state.defragment_boundary.IsValid() ||
+		    segment_idx < vacuum_state.next_vacuum_idx) {
 			auto vacuum_tasks = ScheduleVacuumTasks(checkpoint_state, vacuum_state, segment_idx);
 			if (vacuum_tasks) {
 				// vacuum tasks were scheduled - don't schedule a checkpoint task yet
@@ -1,17 +1,86 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/common/map.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "lz4.hpp"
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// Temporary Block Compression
+//===--------------------------------------------------------------------===//
+// Compressed blocks are written to files with smaller slots. The slot sizes are multiples of the block alloc size
+// divided by TEMPORARY_SLOT_SIZE_CLASSES (aligned to the sector size, so the slots can be written with direct IO),
+// a compressed slot holds the compressed size followed by the LZ4 data.
+static constexpr idx_t TEMPORARY_SLOT_SIZE_CLASSES = 8;
+
+//! Allocates a buffer for a compressed slot, which is aligned to the sector size so it can be used for direct IO
+static unique_ptr<FileBuffer> AllocateSlotBuffer(DatabaseInstance &db, idx_t slot_size) {
+	auto result = make_uniq<FileBuffer>(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
+	                                    slot_size - Storage::DEFAULT_BLOCK_HEADER_SIZE);
+	D_ASSERT(result->AllocSize() == slot_size);
+	return result;
+}
+
+//! Returns the size of the largest slot that a compressed block is written to, or 0 if blocks are not compressed
+static idx_t GetMaxCompressedSlotSize(idx_t alloc_size) {
+	auto slot_granularity = AlignValue<idx_t, Storage::SECTOR_SIZE>(alloc_size / TEMPORARY_SLOT_SIZE_CLASSES);
+	if (slot_granularity >= alloc_size) {
+		return 0;
+	}
+	return alloc_size - slot_granularity;
+}
+
+//! Compresses the buffer into compressed_buffer, and returns the slot size the buffer is written to
+//! If compression does not save at least one slot size class, the buffer is not compressed
+static idx_t CompressTemporaryBuffer(FileBuffer &buffer, FileBuffer &compressed_buffer) {
+	auto alloc_size = buffer.AllocSize();
+	auto max_slot_size = compressed_buffer.AllocSize();
+	D_ASSERT(max_slot_size == GetMaxCompressedSlotSize(alloc_size));
+	auto slot_granularity = alloc_size - max_slot_size;
+
+	auto compressed_data = compressed_buffer.InternalBuffer();
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(
+	    const_char_ptr_cast(buffer.InternalBuffer()), char_ptr_cast(compressed_data + sizeof(idx_t)),
+	    NumericCast<int>(alloc_size), NumericCast<int>(max_slot_size - sizeof(idx_t)));
+	if (compressed_size <= 0) {
+		// the compressed block does not fit in a smaller slot
+		return alloc_size;
+	}
+	auto used_size = sizeof(idx_t) + NumericCast<idx_t>(compressed_size);
+	auto slot_size = (used_size + slot_granularity - 1) / slot_granularity * slot_granularity;
+	Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_data);
+	// zero-initialize the padding of the slot
+	memset(compressed_data + used_size, 0, slot_size - used_size);
+	return slot_size;
+}
+
+static void DecompressTemporaryBuffer(FileBuffer &compressed_buffer, FileBuffer &buffer) {
+	auto compressed_data = compressed_buffer.InternalBuffer();
+	auto compressed_size = Load<idx_t>(compressed_data);
+	if (compressed_size + sizeof(idx_t) > compressed_buffer.AllocSize()) {
+		throw IOException("Corrupt temporary file: compressed block size exceeds the slot size");
+	}
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_data + sizeof(idx_t)), char_ptr_cast(buffer.InternalBuffer()),
+	    NumericCast<int>(compressed_size), NumericCast<int>(buffer.AllocSize()));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer.AllocSize()) {
+		throw IOException("Corrupt temporary file: failed to decompress block");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), block_size(block_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), block_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -53,12 +122,15 @@ idx_t BlockIndexManager::GetMaxIndex() {
 	return max_index;
 }
 
+idx_t BlockIndexManager::GetBlockCount() {
+	return indexes_in_use.size();
+}
+
 bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +138,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +167,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), slot_size(slot_size), db(db),
+      manager(manager), file_index(index),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +190,66 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             optional_ptr<FileBuffer> compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (!compressed_buffer) {
+		D_ASSERT(buffer.AllocSize() == slot_size);
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	D_ASSERT(compressed_buffer->AllocSize() >= slot_size);
+	handle->Write(compressed_buffer->InternalBuffer(), slot_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (slot_size == buffer_manager.GetBlockAllocSize()) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, position, buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	}
+
+	// the block was compressed: read the slot and decompress it into the buffer
+	auto compressed_buffer = manager.GetCompressionBuffer(slot_size);
+	compressed_buffer->Read(*handle, position);
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	DecompressTemporaryBuffer(*compressed_buffer, *buffer);
+	manager.ReturnCompressionBuffer(std::move(compressed_buffer));
+	return buffer;
+}
+
+vector<unique_ptr<FileBuffer>>
+TemporaryFileHandle::ReadTemporaryBuffers(const vector<idx_t> &block_indexes,
+                                          vector<unique_ptr<FileBuffer>> &reusable_buffers) {
+	D_ASSERT(block_indexes.size() == reusable_buffers.size());
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto compressed = slot_size != buffer_manager.GetBlockAllocSize();
+
+	vector<unique_ptr<FileBuffer>> result;
+	vector<unique_ptr<FileBuffer>> compressed_buffers;
+	vector<FileReadRequest> requests;
+	for (idx_t i = 0; i < block_indexes.size(); i++) {
+		auto buffer =
+		    buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffers[i]));
+		auto position = GetPositionInFile(block_indexes[i]);
+		if (compressed) {
+			// read the slot - we decompress it into the buffer after all reads have completed
+			compressed_buffers.push_back(manager.GetCompressionBuffer(slot_size));
+			requests.emplace_back(compressed_buffers.back()->InternalBuffer(), slot_size, position);
+		} else {
+			requests.emplace_back(buffer->InternalBuffer(), buffer->AllocSize(), position);
+		}
+		result.push_back(std::move(buffer));
+	}
+	handle->ReadBatch(requests);
+	for (idx_t i = 0; i < compressed_buffers.size(); i++) {
+		DecompressTemporaryBuffer(*compressed_buffers[i], *result[i]);
+		manager.ReturnCompressionBuffer(std::move(compressed_buffers[i]));
+	}
+	return result;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,15 +277,26 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.block_size = slot_size;
+	info.block_count = index_manager.GetBlockCount();
+	info.uncompressed_size = info.block_count * BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	return info;
 }
 
+idx_t TemporaryFileHandle::GetSlotSize() const {
+	return slot_size;
+}
+
 void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 	if (handle) {
 		return;
 	}
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto open_flags = FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE;
+	if (DBConfig::GetConfig(db).options.use_direct_io) {
+		// all slots are aligned to the sector size, so we can bypass the OS page cache
+		open_flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+	}
 	handle = fs.OpenFile(path, open_flags);
 }
 
@@ -181,7 +314,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -267,11 +400,15 @@ static idx_t GetDefaultMax(const string &path) {
 }
 
 TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
-    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0) {
+    : db(db), buffer_pool(BufferManager::GetBufferManager(db).GetBufferPool()), temp_directory(temp_directory_p),
+      size_on_disk(0), max_swap_space(0) {
 }
 
 TemporaryFileManager::~TemporaryFileManager() {
 	files.clear();
+	for (auto &buffer : compression_buffers) {
+		buffer_pool.UpdateUsedMemory(MemoryTag::ALLOCATOR, -NumericCast<int64_t>(buffer->AllocSize()));
+	}
 }
 
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
@@ -283,11 +420,27 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the buffer (if enabled) before grabbing the lock, this determines the slot size that we write to
+	unique_ptr<FileBuffer> compressed_buffer;
+	auto slot_size = buffer.AllocSize();
+	auto max_slot_size = GetMaxCompressedSlotSize(slot_size);
+	if (DBConfig::GetConfig(db).options.temp_file_compression && max_slot_size != 0) {
+		compressed_buffer = GetCompressionBuffer(max_slot_size);
+		slot_size = CompressTemporaryBuffer(buffer, *compressed_buffer);
+		if (slot_size == buffer.AllocSize()) {
+			// the block is written uncompressed
+			ReturnCompressionBuffer(std::move(compressed_buffer));
+		}
+	}
+
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +450,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +462,41 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
+	if (compressed_buffer) {
+		ReturnCompressionBuffer(std::move(compressed_buffer));
+	}
+}
+
+unique_ptr<FileBuffer> TemporaryFileManager::GetCompressionBuffer(idx_t size) {
+	{
+		lock_guard<mutex> lock(compression_buffers_lock);
+		for (idx_t i = 0; i < compression_buffers.size(); i++) {
+			if (compression_buffers[i]->AllocSize() != size) {
+				continue;
+			}
+			auto result = std::move(compression_buffers[i]);
+			compression_buffers.erase_at(i);
+			return result;
+		}
+	}
+	// blocks are compressed while they are evicted, so we cannot evict other blocks to make room for the buffer here
+	// we charge its memory to the buffer pool, so that subsequent allocations evict more instead
+	buffer_pool.UpdateUsedMemory(MemoryTag::ALLOCATOR, NumericCast<int64_t>(size));
+	return AllocateSlotBuffer(db, size);
+}
+
+void TemporaryFileManager::ReturnCompressionBuffer(unique_ptr<FileBuffer> buffer) {
+	{
+		// we keep at most one buffer per thread around, as a thread (de)compresses one block at a time
+		auto max_cached_buffers = NumericCast<idx_t>(TaskScheduler::GetScheduler(db).NumberOfThreads());
+		lock_guard<mutex> lock(compression_buffers_lock);
+		if (compression_buffers.size() < max_cached_buffers) {
+			compression_buffers.push_back(std::move(buffer));
+			return;
+		}
+	}
+	buffer_pool.UpdateUsedMemory(MemoryTag::ALLOCATOR, -NumericCast<int64_t>(buffer->AllocSize()));
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -383,6 +571,43 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 	return buffer;
 }
 
+vector<unique_ptr<FileBuffer>>
+TemporaryFileManager::ReadTemporaryBuffers(const vector<block_id_t> &ids,
+                                           vector<unique_ptr<FileBuffer>> &reusable_buffers) {
+	D_ASSERT(ids.size() == reusable_buffers.size());
+	// group the blocks by the temporary file they are stored in
+	vector<TemporaryFileIndex> indexes;
+	map<TemporaryFileHandle *, vector<idx_t>> file_blocks;
+	{
+		TemporaryManagerLock lock(manager_lock);
+		for (idx_t i = 0; i < ids.size(); i++) {
+			indexes.push_back(GetTempBlockIndex(lock, ids[i]));
+			file_blocks[GetFileHandle(lock, indexes.back().file_index)].push_back(i);
+		}
+	}
+
+	vector<unique_ptr<FileBuffer>> result(ids.size());
+	for (auto &entry : file_blocks) {
+		vector<idx_t> block_indexes;
+		vector<unique_ptr<FileBuffer>> file_reusable_buffers;
+		for (auto &i : entry.second) {
+			block_indexes.push_back(indexes[i].block_index);
+			file_reusable_buffers.push_back(std::move(reusable_buffers[i]));
+		}
+		auto buffers = entry.first->ReadTemporaryBuffers(block_indexes, file_reusable_buffers);
+		for (idx_t buffer_idx = 0; buffer_idx < buffers.size(); buffer_idx++) {
+			result[entry.second[buffer_idx]] = std::move(buffers[buffer_idx]);
+		}
+	}
+
+	// remove the blocks (and potentially erase the temp files)
+	TemporaryManagerLock lock(manager_lock);
+	for (idx_t i = 0; i < ids.size(); i++) {
+		EraseUsedBlock(lock, ids[i], GetFileHandle(lock, indexes[i].file_index), indexes[i]);
+	}
+	return result;
+}
+
 void TemporaryFileManager::DeleteTemporaryBuffer(block_id_t id) {
 	TemporaryManagerLock lock(manager_lock);
 	auto index = GetTempBlockIndex(lock, id);
@@ -8,10 +8,11 @@
 
 namespace duckdb {
 
-TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
-      minimum_reservation(minimum_reservation_p), reservation(0), materialization_penalty(1) {
+TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p, ClientContext &context_p,
+                                           idx_t query_memory_limit_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p),
+      query_memory_limit(query_memory_limit_p), remaining_size(0), minimum_reservation(minimum_reservation_p),
+      reservation(0), materialization_penalty(1) {
 }
 
 TemporaryMemoryState::~TemporaryMemoryState() {
@@ -102,11 +103,14 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
+	const auto query_memory_limit = ClientConfig::GetConfig(context).query_memory_limit;
+	const auto reservation_limit = MinValue(memory_limit, MinValue(query_max_memory, query_memory_limit));
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
-	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	                                    reservation_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto result = unique_ptr<TemporaryMemoryState>(
+	    new TemporaryMemoryState(*this, context, query_memory_limit, minimum_reservation));
 	SetRemainingSize(*result, result->GetMinimumReservation());
-	SetReservation(*result, result->GetMinimumReservation());
+	SetReservation(*result, MinValue(result->GetMinimumReservation(), GetQueryFreeMemory(*result)));
 	active_states.insert(*result);
 
 	Verify();
@@ -116,9 +120,14 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
 
-	// The lower bound for the reservation of this state is either the minimum reservation or the remaining size
+	// The memory that the query of this state can still reserve without exceeding its query_memory_limit
+	const auto query_free_memory = GetQueryFreeMemory(temporary_memory_state);
+
+	// The lower bound for the reservation of this state is either the minimum reservation or the remaining size,
+	// but never more than what the query can still reserve
 	const auto lower_bound =
-	    MinValue(temporary_memory_state.GetMinimumReservation(), temporary_memory_state.GetRemainingSize());
+	    MinValue(MinValue(temporary_memory_state.GetMinimumReservation(), temporary_memory_state.GetRemainingSize()),
+	             query_free_memory);
 
 	if (temporary_memory_state.GetRemainingSize() == 0) {
 		// Sometimes set to 0 to denote end of state (before actually deleting the state)
@@ -128,6 +137,14 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		SetReservation(temporary_memory_state, lower_bound);
 	} else if (!has_temporary_directory) {
 		// We cannot offload, so we cannot limit memory usage. Set reservation equal to the remaining size
+		if (temporary_memory_state.GetRemainingSize() > query_free_memory) {
+			// The query would exceed its query_memory_limit, which we can only enforce by offloading
+			throw OutOfMemoryException(
+			    "failed to reserve %s of memory for the query: this exceeds the query_memory_limit of %s, and there is "
+			    "no temporary directory to offload data to",
+			    StringUtil::BytesToHumanReadableString(temporary_memory_state.GetRemainingSize()),
+			    StringUtil::BytesToHumanReadableString(temporary_memory_state.query_memory_limit));
+		}
 		SetReservation(temporary_memory_state, temporary_memory_state.GetRemainingSize());
 	} else if (reservation - temporary_memory_state.GetReservation() + lower_bound >= memory_limit) {
 		// We overshot. Set reservation equal to the minimum
@@ -137,17 +154,22 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// 4. The memory that the query can still reserve within its query_memory_limit
 		auto upper_bound = MinValue(temporary_memory_state.GetRemainingSize(), query_max_memory);
 		const auto free_memory = memory_limit - (reservation - temporary_memory_state.GetReservation());
 		upper_bound = MinValue(upper_bound,
 		                       LossyNumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * static_cast<double>(free_memory)));
 		upper_bound = MinValue(upper_bound, free_memory);
+		upper_bound = MinValue(upper_bound, query_free_memory);
 
 		idx_t new_reservation;
 		if (lower_bound >= upper_bound) {
 			new_reservation = lower_bound;
+		} else if (remaining_size > memory_limit) {
+			new_reservation = MinValue(ComputeReservation(temporary_memory_state), query_free_memory);
+			new_reservation = MaxValue(new_reservation, lower_bound);
 		} else {
-			new_reservation = remaining_size > memory_limit ? ComputeReservation(temporary_memory_state) : upper_bound;
+			new_reservation = upper_bound;
 		}
 
 		SetReservation(temporary_memory_state, new_reservation);
@@ -320,6 +342,23 @@ idx_t TemporaryMemoryManager::ComputeReservation(const TemporaryMemoryState &tem
 	throw InternalException("Did not find state_index in ComputeOptimalReservation");
 }
 
+idx_t TemporaryMemoryManager::GetQueryFreeMemory(const TemporaryMemoryState &temporary_memory_state) const {
+	const auto query_memory_limit = temporary_memory_state.query_memory_limit;
+	if (query_memory_limit == NumericLimits<idx_t>::Maximum()) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	// The states of the query of a client share its query_memory_limit
+	idx_t query_reservation = 0;
+	for (auto &active_state : active_states) {
+		auto &state = active_state.get();
+		if (!RefersToSameObject(state, temporary_memory_state) &&
+		    RefersToSameObject(state.context, temporary_memory_state.context)) {
+			query_reservation += state.GetReservation();
+		}
+	}
+	return query_memory_limit > query_reservation ? query_memory_limit - query_reservation : 0;
+}
+
 void TemporaryMemoryManager::Verify() const {
 #ifdef DEBUG
 	idx_t total_reservation = 0;
@@ -14,6 +14,7 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
@@ -22,7 +23,8 @@ namespace duckdb {
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), flushed_bytes(0), synced_bytes(0),
+      sync_in_progress(false) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -68,6 +70,10 @@ void WriteAheadLog::Truncate(idx_t size) {
 	}
 	writer->Truncate(size);
 	wal_size = writer->GetFileSize();
+	// the truncated data was never part of a successful commit - forget that it was (possibly) synced
+	flushed_bytes = writer->GetTotalWritten();
+	lock_guard<mutex> guard(sync_lock);
+	synced_bytes = MinValue<idx_t>(synced_bytes, flushed_bytes);
 }
 
 void WriteAheadLog::Delete() {
@@ -78,6 +84,9 @@ void WriteAheadLog::Delete() {
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
 	wal_size = 0;
+	flushed_bytes = 0;
+	lock_guard<mutex> guard(sync_lock);
+	synced_bytes = 0;
 }
 
 //===--------------------------------------------------------------------===//
@@ -409,7 +418,7 @@ void WriteAheadLog::WriteAlter(const AlterInfo &info) {
 //===--------------------------------------------------------------------===//
 // FLUSH
 //===--------------------------------------------------------------------===//
-void WriteAheadLog::Flush() {
+void WriteAheadLog::Flush(bool group_commit) {
 	if (!writer) {
 		return;
 	}
@@ -418,9 +427,50 @@ void WriteAheadLog::Flush() {
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
 
+	if (group_commit) {
+		// write the changes to the file - the sync is performed in WaitForSync, together with other committers
+		writer->Flush();
+		wal_size = writer->GetFileSize();
+		flushed_bytes = writer->GetTotalWritten();
+		return;
+	}
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+	flushed_bytes = writer->GetTotalWritten();
+	lock_guard<mutex> guard(sync_lock);
+	synced_bytes = MaxValue<idx_t>(synced_bytes, flushed_bytes);
+}
+
+void WriteAheadLog::WaitForSync(idx_t written_bytes) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_bytes < written_bytes) {
+		if (sync_in_progress) {
+			// another committer is syncing - wait for it to finish, it might cover our changes as well
+			sync_cv.wait(guard);
+			continue;
+		}
+		// we are the leader of this group: wait for other committers to join, then sync everything written so far
+		sync_in_progress = true;
+		guard.unlock();
+		auto &config = DBConfig::Get(database);
+		if (config.options.wal_group_commit_max_wait > 0) {
+			std::this_thread::sleep_for(std::chrono::microseconds(config.options.wal_group_commit_max_wait));
+		}
+		idx_t sync_target = flushed_bytes;
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_cv.notify_all();
+			throw;
+		}
+		guard.lock();
+		sync_in_progress = false;
+		synced_bytes = MaxValue<idx_t>(synced_bytes, sync_target);
+		sync_cv.notify_all();
+	}
 }
 
 } // namespace duckdb
@@ -217,7 +217,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 }
 
 ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id,
-                                  unique_ptr<StorageCommitState> commit_state) noexcept {
+                                  unique_ptr<StorageCommitState> commit_state, bool group_commit) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
@@ -235,7 +235,7 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		undo_buffer.Commit(iterator_state, commit_id);
 		if (commit_state) {
 			// if we have written to the WAL - flush after the commit has been successful
-			commit_state->FlushCommit();
+			commit_state->FlushCommit(group_commit);
 		}
 		return ErrorData();
 	} catch (std::exception &ex) {
@@ -20,6 +20,7 @@ namespace duckdb {
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
+	last_write_commit = 0;
 	// transaction ID starts very high:
 	// it should be much higher than the current start timestamp
 	// if transaction_id < start_timestamp for any set of active transactions
@@ -34,6 +35,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpoints();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -104,6 +106,12 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+	if (config.options.background_checkpoint) {
+		// commit through the WAL and leave the checkpoint to the background checkpoint thread
+		CheckpointDecision decision("checkpointing in the background");
+		decision.checkpoint_in_background = true;
+		return decision;
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -148,6 +156,36 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 }
 
 void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
+	// a background checkpoint has no query to report its error to - report it to the next explicit checkpoint instead
+	ErrorData error;
+	{
+		lock_guard<mutex> guard(background_checkpoint_lock);
+		error = std::move(background_checkpoint_error);
+		background_checkpoint_error = ErrorData();
+	}
+	if (error.HasError()) {
+		error.Throw();
+	}
+	CheckpointInternal(context, force, false);
+}
+
+void DuckTransactionManager::DefragmentCheckpoint(ClientContext &context) {
+	static constexpr const idx_t MAX_DEFRAGMENT_CHECKPOINTS = 3;
+
+	// relocated data can only be written to blocks that are free when the checkpoint starts - the blocks it moves away
+	// from only become free after the checkpoint. Data that does not fit is written past the end of the file, so we
+	// keep checkpointing for as long as that changes the size of the file
+	auto &storage_manager = db.GetStorageManager();
+	for (idx_t i = 0; i < MAX_DEFRAGMENT_CHECKPOINTS; i++) {
+		auto total_blocks = storage_manager.GetDatabaseSize().total_blocks;
+		CheckpointInternal(context, false, true);
+		if (storage_manager.GetDatabaseSize().total_blocks == total_blocks) {
+			break;
+		}
+	}
+}
+
+void DuckTransactionManager::CheckpointInternal(ClientContext &context, bool force, bool defragment) {
 	auto &storage_manager = db.GetStorageManager();
 	if (storage_manager.InMemory()) {
 		return;
@@ -195,6 +233,11 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 		// we cannot do a full checkpoint if any transaction needs to read old data
 		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
 	}
+	if (defragment) {
+		// relocating data requires writing a checkpoint even if nothing has changed
+		options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+		options.defragment = true;
+	}
 	storage_manager.CreateCheckpoint(options);
 }
 
@@ -215,8 +258,9 @@ transaction_t DuckTransactionManager::GetCommitTimestamp() {
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	unique_lock<mutex> tlock(transaction_lock);
+	const auto changes_made = transaction.ChangesMade();
 	if (!db.IsSystem() && !db.IsTemporary()) {
-		if (transaction.ChangesMade()) {
+		if (changes_made) {
 			if (transaction.IsReadOnly()) {
 				throw InternalException("Attempting to commit a transaction that is read-only but has made changes - "
 				                        "this should not be possible");
@@ -231,6 +275,8 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	// read the group commit setting only once, so that writing and syncing the WAL agree even if it is changed
+	const bool group_commit = DBConfig::Get(db).options.wal_group_commit;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -256,7 +302,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, std::move(commit_state), group_commit);
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -268,6 +314,24 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		if (changes_made) {
+			last_write_commit = commit_id;
+		}
+	}
+	if (held_wal_lock && !error.HasError() && group_commit) {
+		// with group commit the WAL has been written but not yet synced - release the WAL lock so other transactions
+		// can write their changes, and wait until a (shared) fsync has made our changes durable
+		auto wal = db.GetStorageManager().GetWAL();
+		auto written_bytes = wal->GetTotalWritten();
+		tlock.unlock();
+		held_wal_lock.reset();
+		try {
+			wal->WaitForSync(written_bytes);
+		} catch (std::exception &ex) {
+			ErrorData sync_error(ex);
+			throw FatalException("Failed to sync the write-ahead log: %s", sync_error.RawMessage());
+		}
+		tlock.lock();
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -292,10 +356,104 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		options.type = checkpoint_decision.type;
 		auto &storage_manager = db.GetStorageManager();
 		storage_manager.CreateCheckpoint(options);
+	} else if (checkpoint_decision.checkpoint_in_background && !error.HasError()) {
+		ScheduleBackgroundCheckpoint();
 	}
 	return error;
 }
 
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (background_checkpoint_shutdown) {
+		return;
+	}
+	background_checkpoint_requested = true;
+	if (!background_checkpoint_thread) {
+		background_checkpoint_thread = make_uniq<thread>([this]() { RunBackgroundCheckpoints(); });
+	}
+	background_checkpoint_cv.notify_one();
+}
+
+void DuckTransactionManager::StopBackgroundCheckpoints() {
+	unique_ptr<thread> background_thread;
+	{
+		lock_guard<mutex> guard(background_checkpoint_lock);
+		background_checkpoint_shutdown = true;
+		background_thread = std::move(background_checkpoint_thread);
+		background_checkpoint_cv.notify_one();
+	}
+	if (background_thread) {
+		background_thread->join();
+	}
+}
+
+void DuckTransactionManager::RunBackgroundCheckpoints() {
+	static constexpr std::chrono::milliseconds RETRY_INTERVAL(10);
+
+	unique_lock<mutex> guard(background_checkpoint_lock);
+	auto has_work = [&]() {
+		return background_checkpoint_requested || background_checkpoint_shutdown;
+	};
+	idx_t failed_attempts = 0;
+	while (true) {
+		background_checkpoint_cv.wait(guard, has_work);
+		if (background_checkpoint_shutdown) {
+			return;
+		}
+		background_checkpoint_requested = false;
+		guard.unlock();
+		// under a sustained write load there might never be a moment without active write transactions
+		// after too many attempts we stop new write transactions from starting until the checkpoint is done
+		bool block_writers = failed_attempts >= MAX_BACKGROUND_CHECKPOINT_ATTEMPTS;
+		bool checkpointed = TryBackgroundCheckpoint(block_writers);
+		guard.lock();
+		if (checkpointed) {
+			failed_attempts = 0;
+		} else {
+			// write transactions are active - wait a bit before retrying
+			failed_attempts++;
+			background_checkpoint_requested = true;
+			background_checkpoint_cv.wait_for(guard, RETRY_INTERVAL,
+			                                  [&]() { return background_checkpoint_shutdown; });
+		}
+	}
+}
+
+bool DuckTransactionManager::TryBackgroundCheckpoint(bool block_writers) {
+	// the exclusive checkpoint lock can only be obtained while there are no active write transactions
+	// new write transactions wait for the checkpoint to finish
+	unique_ptr<StorageLockKey> lock;
+	if (block_writers) {
+		// block new write transactions and wait for the active ones to finish
+		lock = checkpoint_lock.GetExclusiveLock();
+	} else {
+		lock = checkpoint_lock.TryGetExclusiveLock();
+		if (!lock) {
+			return false;
+		}
+	}
+	auto &storage_manager = db.GetStorageManager();
+	if (!storage_manager.AutomaticCheckpoint(0)) {
+		// another checkpoint has happened in the mean time
+		return true;
+	}
+	CheckpointOptions options;
+	if (GetLastCommit() > LowestActiveStart()) {
+		// we cannot do a full checkpoint if any transaction needs to read old data
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+	}
+	try {
+		storage_manager.CreateCheckpoint(options);
+	} catch (std::exception &ex) {
+		// there is no query to report the error to here - keep it around for the next explicit checkpoint
+		ErrorData error(ex);
+		lock_guard<mutex> guard(background_checkpoint_lock);
+		auto message = StringUtil::Format("Failed to checkpoint in the background: %s", error.RawMessage());
+		background_checkpoint_error = ErrorData(error.Type(), message);
+	}
+	return true;
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
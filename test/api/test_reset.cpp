@@ -46,6 +46,7 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
+	    {"buffer_eviction_policy", {"2q"}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
@@ -77,6 +78,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"home_directory", {"test"}},
 	    {"allow_extensions_metadata_mismatch", {"true"}},
 	    {"extension_directory", {"test"}},
+	    {"join_build_cache_size", {"1.0 GiB"}},
 	    {"max_expression_depth", {50}},
 	    {"max_memory", {"4.0 GiB"}},
 	    {"max_temp_directory_size", {"10.0 GiB"}},
@@ -98,7 +100,9 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"scalar_subquery_error_on_multiple_rows", {false}},
 	    {"ieee_floating_point_ops", {false}},
 	    {"progress_bar_time", {0}},
+	    {"query_memory_limit", {"1.0 GiB"}},
 	    {"temp_directory", {"tmp"}},
+	    {"vacuum_rewrite_threshold", {Value::DOUBLE(0.5)}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"http_proxy", {"localhost:80"}},
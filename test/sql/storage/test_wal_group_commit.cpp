@@ -0,0 +1,81 @@
+#include "catch.hpp"
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+//! Local file system that counts the number of times the write-ahead log is synced
+class WALSyncCountingFileSystem : public LocalFileSystem {
+public:
+	explicit WALSyncCountingFileSystem(atomic<idx_t> &wal_syncs) : wal_syncs(wal_syncs) {
+	}
+
+	void FileSync(FileHandle &handle) override {
+		if (StringUtil::EndsWith(handle.path, ".wal")) {
+			wal_syncs++;
+		}
+		LocalFileSystem::FileSync(handle);
+	}
+
+private:
+	atomic<idx_t> &wal_syncs;
+};
+
+static constexpr idx_t GROUP_COMMIT_THREADS = 8;
+static constexpr idx_t GROUP_COMMIT_INSERTS = 10;
+
+static void InsertValues(DuckDB &db, idx_t thread_idx) {
+	Connection con(db);
+	for (idx_t i = 0; i < GROUP_COMMIT_INSERTS; i++) {
+		auto value = to_string(thread_idx * GROUP_COMMIT_INSERTS + i);
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (" + value + ")"));
+	}
+}
+
+static idx_t RunConcurrentCommits(DuckDB &db, atomic<idx_t> &wal_syncs) {
+	wal_syncs = 0;
+	duckdb::vector<std::thread> threads;
+	for (idx_t thread_idx = 0; thread_idx < GROUP_COMMIT_THREADS; thread_idx++) {
+		threads.emplace_back(InsertValues, std::ref(db), thread_idx);
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	return wal_syncs;
+}
+
+TEST_CASE("Test that group commit shares WAL syncs between concurrent commits", "[storage]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("wal_group_commit_syncs");
+	atomic<idx_t> wal_syncs(0);
+	config->file_system = make_uniq<WALSyncCountingFileSystem>(wal_syncs);
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+
+		// without group commit every commit syncs the WAL
+		auto commit_count = GROUP_COMMIT_THREADS * GROUP_COMMIT_INSERTS;
+		REQUIRE(RunConcurrentCommits(db, wal_syncs) == commit_count);
+
+		// with group commit the leader waits for other commits to join, and syncs them together
+		REQUIRE_NO_FAIL(con.Query("SET wal_group_commit=true"));
+		REQUIRE_NO_FAIL(con.Query("SET wal_group_commit_max_wait=10000"));
+		auto group_syncs = RunConcurrentCommits(db, wal_syncs);
+		REQUIRE(group_syncs > 0);
+		REQUIRE(group_syncs < commit_count);
+
+		auto result = con.Query("SELECT COUNT(*), COUNT(DISTINCT i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(2 * commit_count)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(commit_count)}));
+	}
+	DeleteDatabase(storage_database);
+}